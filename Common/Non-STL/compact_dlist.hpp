@@ -0,0 +1,546 @@
+#if !defined(GUARD_COMPACT_DLIST_HPP)
+#define GUARD_COMPACT_DLIST_HPP
+
+/** @file: compact_dlist.hpp
+@author Robbie Brandrick
+@author r_brandrick@fanshaweonline.ca
+@date 2012-02-24
+@version 0.1.0
+@note Targets Visual C++ 10.0
+@briefs Compact Doubly Linkedlist.
+		compact_dlist class declaration and implementation.
+		compact_dlist iterator declarations and implementation
+		compact_dlist constant iterator declarations and implementation
+		The nodes live in one array owned by the list and are linked by 32 bit indices, so a node is
+		the value plus eight bytes where a dlist node is the value plus two pointers.
+@invariant compact_dlist always contains the head node at index 0, free nodes are chained through next_*/
+
+#include <iterator>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <memory>
+#include <new>
+#include <type_traits>
+//Forward Declaration
+template<typename T_, typename Allocator_ = std::allocator<T_>> class compact_dlist;
+template<typename T_, typename Allocator_ = std::allocator<T_>> class compact_dlist_iterator;
+template<typename T_, typename Allocator_ = std::allocator<T_>> class const_compact_dlist_iterator;
+
+template<typename T_>
+struct compact_dlist_node{
+	typedef std::uint32_t	link_type;
+
+	link_type	next_;
+	link_type	prev_;
+	//the head and free nodes hold no value, so the value is only constructed in linked nodes
+	typename std::aligned_storage<sizeof(T_), alignof(T_)>::type elem_;
+
+	T_& value(){return *reinterpret_cast<T_*>(&elem_);}
+	T_ const& value() const{return *reinterpret_cast<T_ const*>(&elem_);}
+};
+
+template<typename T_, typename Allocator_>
+class compact_dlist{
+	//Allow The Following class to access compact_dlist private members
+	template<typename U_, typename A_> friend class compact_dlist_iterator;
+	template<typename U_, typename A_> friend class const_compact_dlist_iterator;
+public:
+	typedef std::size_t			size_type;
+	typedef std::ptrdiff_t		difference_type;
+	typedef T_					value_type;
+	typedef T_&					reference_type;
+	typedef T_ const&			const_reference_type;
+	typedef Allocator_			allocator_type;
+	typedef compact_dlist_node<T_>				node_type;
+	typedef typename node_type::link_type		link_type;
+	typedef compact_dlist_iterator<T_, Allocator_>			iterator;
+	typedef const_compact_dlist_iterator<T_, Allocator_>	const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	compact_dlist();
+	explicit compact_dlist(allocator_type const& alloc);
+	compact_dlist(compact_dlist<T_, Allocator_> const& rhs);
+	compact_dlist(compact_dlist<T_, Allocator_> && rhs);
+	compact_dlist& operator=(compact_dlist<T_, Allocator_> const& rhs);
+	compact_dlist& operator=(compact_dlist<T_, Allocator_> && rhs);
+	~compact_dlist();
+
+	allocator_type get_allocator() const{return allocator_type(alloc_);}
+
+	iterator begin(){return iterator(nodes_[0].next_, this);}
+	const_iterator begin()const{return const_iterator(nodes_[0].next_, this);}
+	const_iterator cbegin() const{return const_iterator(nodes_[0].next_, this);}
+
+	reverse_iterator rbegin(){return reverse_iterator(end());}
+	const_reverse_iterator rbegin()const{return const_reverse_iterator(cend());}
+	const_reverse_iterator crbegin()const{return const_reverse_iterator(cend());}
+
+	iterator end(){return iterator(0, this);}
+	const_iterator end() const{return const_iterator(0, this);}
+	const_iterator cend() const{return const_iterator(0, this);}
+
+	reverse_iterator rend(){return reverse_iterator(begin());}
+	const_reverse_iterator rend()const{return const_reverse_iterator(cbegin());}
+	const_reverse_iterator crend()const{return const_reverse_iterator(cbegin());}
+
+	reference_type front(){assert(!(size_ == 0)); return nodes_[nodes_[0].next_].value();}
+	const_reference_type front() const{assert(!(size_ == 0)); return nodes_[nodes_[0].next_].value();}
+	reference_type back(){assert(!(size_ == 0)); return nodes_[nodes_[0].prev_].value();}
+	const_reference_type back() const{assert(!(size_ == 0)); return nodes_[nodes_[0].prev_].value();}
+	size_type size() const{return size_;}
+	bool empty() const{return size_ == 0;}
+	size_type capacity() const{return capacity_ - 1;}
+	void reserve(size_type count);
+	void clear();
+
+	void push_back(const_reference_type value){emplace(end(), value);}
+	void push_back(value_type&& value){emplace(end(), std::move(value));}
+	void push_front(const_reference_type value){emplace(begin(), value);}
+	void push_front(value_type&& value){emplace(begin(), std::move(value));}
+	template<typename... Args>
+	void emplace_back(Args&&... args){emplace(end(), std::forward<Args>(args)...);}
+	template<typename... Args>
+	void emplace_front(Args&&... args){emplace(begin(), std::forward<Args>(args)...);}
+	void pop_back();
+	void pop_front();
+
+	iterator insert( const iterator position, const_reference_type x){return emplace(position, x);}
+	iterator insert( const iterator position, value_type&& x){return emplace(position, std::move(x));}
+	template<typename... Args>
+	iterator emplace( const iterator position, Args&&... args);
+	iterator erase( const iterator position);
+	iterator erase( iterator first, const iterator last);
+	void splice( const iterator position, compact_dlist<T_, Allocator_>& other);
+	void splice( const iterator position, compact_dlist<T_, Allocator_>& other, iterator i);
+	void splice( const iterator position, compact_dlist<T_, Allocator_>& other, iterator first, iterator last);
+private:
+	typedef typename std::allocator_traits<Allocator_>::template rebind_alloc<node_type> node_allocator;
+	typedef std::allocator_traits<node_allocator> node_traits;
+
+	node_allocator alloc_;
+	node_type* nodes_;
+	link_type capacity_;
+	link_type free_;
+	size_type size_;
+
+	template<typename... Args>
+	link_type createNode(Args&&... args);
+	void destroyNode(link_type node);
+	void link(link_type position, link_type node);
+	void unlink(link_type node);
+	void grow(node_type* nodes, link_type capacity);
+	void dispose();
+};
+/*		@fn:	    compact_dlist();
+*		@brief:		default constructor
+*		@pram:		none.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		A compact_dlist object will be constructed holding only its head node.*/
+template<typename T_, typename Allocator_>
+compact_dlist<T_, Allocator_>::compact_dlist() : nodes_(nullptr), capacity_(0), free_(0), size_(0){
+	grow(node_traits::allocate(alloc_, 1), 1);
+}
+/*		@fn:	    compact_dlist(allocator_type const& alloc);
+*		@brief:		allocator constructor
+*		@pram:		allocator_type const& alloc [in] allocator the node array is taken from.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		A compact_dlist object will be constructed holding only its head node.*/
+template<typename T_, typename Allocator_>
+compact_dlist<T_, Allocator_>::compact_dlist(typename compact_dlist<T_, Allocator_>::allocator_type const& alloc) : alloc_(alloc), nodes_(nullptr), capacity_(0), free_(0), size_(0){
+	grow(node_traits::allocate(alloc_, 1), 1);
+}
+/*		@fn:		compact_dlist(compact_dlist const& rhs);
+*		@brief:		copy constructor
+*		@pram:		compact_dlist const& rhs [in] object to copy.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		The values of rhs are copied in order into a node array just large enough to hold them*/
+template<typename T_, typename Allocator_>
+compact_dlist<T_, Allocator_>::compact_dlist(compact_dlist<T_, Allocator_> const& rhs)
+	: alloc_(node_traits::select_on_container_copy_construction(rhs.alloc_)), nodes_(nullptr), capacity_(0), free_(0), size_(0){
+	grow(node_traits::allocate(alloc_, rhs.size_ + 1), static_cast<link_type>(rhs.size_ + 1));
+	for(const_iterator iter = rhs.cbegin(); iter != rhs.cend(); ++iter)
+		push_back(*iter);
+}
+/*		@fn:		compact_dlist(compact_dlist && rhs);
+*		@brief:		move constructor
+*		@pram:		compact_dlist && rhs [in] object to move from.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		The node array of rhs is taken over, rhs is left empty with a new head node*/
+template<typename T_, typename Allocator_>
+compact_dlist<T_, Allocator_>::compact_dlist(compact_dlist<T_, Allocator_> && rhs)
+	: alloc_(rhs.alloc_), nodes_(nullptr), capacity_(0), free_(0), size_(0){
+	grow(node_traits::allocate(alloc_, 1), 1);
+	std::swap(this->nodes_, rhs.nodes_);
+	std::swap(this->capacity_, rhs.capacity_);
+	std::swap(this->free_, rhs.free_);
+	std::swap(this->size_, rhs.size_);
+}
+/*		@fn:		compact_dlist& operator=(compact_dlist const& rhs);
+*		@brief:		copy assignment
+*		@pram:		compact_dlist const& rhs [in] object to copy.
+*		@return:	compact_dlist&, reference to this.
+*		@pre:		none.
+*		@post:		This list holds copies of the values of rhs*/
+template<typename T_, typename Allocator_>
+compact_dlist<T_, Allocator_>& compact_dlist<T_, Allocator_>::operator=(compact_dlist<T_, Allocator_> const& rhs){
+	if(this != &rhs){
+		compact_dlist<T_, Allocator_> copy(rhs);
+		*this = std::move(copy);
+	}
+	return *this;
+}
+/*		@fn:		compact_dlist& operator=(compact_dlist && rhs);
+*		@brief:		move assignment
+*		@pram:		compact_dlist && rhs [in] object to move from.
+*		@return:	compact_dlist&, reference to this.
+*		@pre:		none.
+*		@post:		This list owns the node array of rhs, rhs is left empty with the node array of this list*/
+template<typename T_, typename Allocator_>
+compact_dlist<T_, Allocator_>& compact_dlist<T_, Allocator_>::operator=(compact_dlist<T_, Allocator_> && rhs){
+	if(this != &rhs){
+		clear();
+		std::swap(this->alloc_, rhs.alloc_);
+		std::swap(this->nodes_, rhs.nodes_);
+		std::swap(this->capacity_, rhs.capacity_);
+		std::swap(this->free_, rhs.free_);
+		std::swap(this->size_, rhs.size_);
+	}
+	return *this;
+}
+/*		@fn:		~compact_dlist();
+*		@brief:		destructs the current object and calls the dispose() method.
+*		@pram:		none.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		object of compact_dlist will be destructed*/
+template<typename T_, typename Allocator_>
+compact_dlist<T_, Allocator_>::~compact_dlist(){
+	dispose();
+}
+/*		@fn:		void reserve(size_type count)
+*		@brief:		Makes room for count values without growing the node array again
+*		@pram:		size_type count [in] number of values to make room for.
+*		@return:	void.
+*		@pre:		count must fit in 32 bits.
+*		@post:		Values are moved to the new node array, iterators stay valid, references do not*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::reserve(size_type count){
+	if(count + 1 <= capacity_)
+		return;
+	assert(count < static_cast<link_type>(-1));
+	link_type capacity = static_cast<link_type>(count + 1);
+	grow(node_traits::allocate(alloc_, capacity), capacity);
+}
+/*		@fn:		void clear()
+*		@brief:		Empties all of compact_dlist's nodes
+*		@pram:		none.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		Every value is destroyed, the node array is kept for reuse*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::clear(){
+	while(size_ != 0)
+		pop_back();
+}
+/*		@fn:        void pop_back()
+*		@brief:		removes the node linked before the head
+*		@pram:		none.
+*		@return:		void.
+*		@pre:		There must be at least one node, other than the head, in the compact_dlist
+*		@post:		the node is put on the free list*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::pop_back(){
+	assert(!(size_ == 0));
+	link_type node = nodes_[0].prev_;
+	unlink(node);
+	destroyNode(node);
+	--size_;
+}
+/*		@fn:        void pop_front()
+*		@brief:		removes the node linked after the head
+*		@pram:		none.
+*		@return:		void.
+*		@pre:		There must be at least one node, other than the head, in the compact_dlist
+*		@post:		the node is put on the free list*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::pop_front(){
+	assert(!(size_ == 0));
+	link_type node = nodes_[0].next_;
+	unlink(node);
+	destroyNode(node);
+	--size_;
+}
+/*		@fn:		iterator emplace(iterator position, Args&&... args)
+*		@brief:		The list container is extended by constructing a new element before the element at position.
+*		@pram:		iterator position [in] Position in the container where the new element is constructed.
+*					Args&&... args [in] arguments forwarded to the value's constructor.
+*		@return:	iterator that points to the newly constructed element.
+*		@pre:	    position must belong to this list
+*		@post:		a value built from args is added to the list before the parameter position node*/
+template<typename T_, typename Allocator_>
+template< typename... Args>
+typename compact_dlist<T_, Allocator_>::iterator compact_dlist<T_, Allocator_>::emplace(const typename compact_dlist<T_, Allocator_>::iterator position, Args&&... args){
+	assert(!(this != position.list_));
+	link_type node = createNode(std::forward<Args>(args)...);
+	link(position.node_, node);
+	++size_;
+	return iterator(node, this);
+}
+/*		@fn:		iterator erase(iterator position)
+*		@brief:		Removes a single element from the list container
+*		@pram:		iterator position [in] Iterator pointing to the element to be removed.
+*		@return:	iterator pointing to the element that followed the erased one
+*		@pre:	    position must reference a value of this list
+*		@post:		The node is put on the free list, iterators to other nodes stay valid*/
+template<typename T_, typename Allocator_>
+typename compact_dlist<T_, Allocator_>::iterator compact_dlist<T_, Allocator_>::erase(const typename compact_dlist<T_, Allocator_>::iterator position){
+	assert(!(size_ == 0));
+	assert(!(position.node_ == 0));
+	assert(!(this != position.list_));
+	link_type next = nodes_[position.node_].next_;
+	unlink(position.node_);
+	destroyNode(position.node_);
+	--size_;
+	return iterator(next, this);
+}
+/*		@fn:		iterator erase(iterator first, iterator last)
+*		@brief:		Removes the elements in [first, last)
+*		@pram:		iterator first [in] first element to be removed.
+*					iterator last [in] one past the last element to be removed.
+*		@return:	iterator last
+*		@pre:	    the range must belong to this list
+*		@post:		The nodes are put on the free list*/
+template<typename T_, typename Allocator_>
+typename compact_dlist<T_, Allocator_>::iterator compact_dlist<T_, Allocator_>::erase(typename compact_dlist<T_, Allocator_>::iterator first, const typename compact_dlist<T_, Allocator_>::iterator last){
+	while(first != last)
+		first = erase(first);
+	return first;
+}
+/*		@fn:		void splice(iterator position, compact_dlist& other)
+*		@brief:		Moves every value of other in front of position
+*		@pram:		iterator position [in] Position in this list the values go in front of.
+*					compact_dlist& other [in/out] list giving up its values, may not be this list.
+*		@return:	void.
+*		@pre:	    position must belong to this list
+*		@post:		other is empty. The node arrays are separate so the values are moved and not relinked*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::splice(const typename compact_dlist<T_, Allocator_>::iterator position, compact_dlist<T_, Allocator_>& other){
+	if(this == &other)
+		return;
+	splice(position, other, other.begin(), other.end());
+}
+/*		@fn:		void splice(iterator position, compact_dlist& other, iterator i)
+*		@brief:		Moves the value at i from other in front of position
+*		@pram:		iterator position [in] Position in this list the value goes in front of.
+*					compact_dlist& other [in/out] list holding i, may be this list.
+*					iterator i [in] value to be moved.
+*		@return:	void.
+*		@pre:	    position must belong to this list and i must reference a value of other
+*		@post:		Within one list the node is relinked, between lists the value is moved into a new node.
+*						Either way it is constant time and iterators to the other values stay valid*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::splice(const typename compact_dlist<T_, Allocator_>::iterator position, compact_dlist<T_, Allocator_>& other, typename compact_dlist<T_, Allocator_>::iterator i){
+	assert(!(this != position.list_));
+	assert(!(&other != i.list_));
+	assert(!(i.node_ == 0));
+	if(this == &other){
+		if(i.node_ == position.node_ || nodes_[i.node_].next_ == position.node_)
+			return;
+		unlink(i.node_);
+		link(position.node_, i.node_);
+		return;
+	}
+	emplace(position, std::move(other.nodes_[i.node_].value()));
+	other.erase(i);
+}
+/*		@fn:		void splice(iterator position, compact_dlist& other, iterator first, iterator last)
+*		@brief:		Moves the values in [first, last) from other in front of position
+*		@pram:		iterator position [in] Position in this list the values go in front of.
+*					compact_dlist& other [in/out] list holding the range, may be this list.
+*					iterator first [in] first value to be moved.
+*					iterator last [in] one past the last value to be moved.
+*		@return:	void.
+*		@pre:	    position must belong to this list and not be inside the range, the range must belong to other
+*		@post:		The values keep their order in front of position*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::splice(const typename compact_dlist<T_, Allocator_>::iterator position, compact_dlist<T_, Allocator_>& other, typename compact_dlist<T_, Allocator_>::iterator first, typename compact_dlist<T_, Allocator_>::iterator last){
+	while(first != last){
+		iterator moved = first++;
+		splice(position, other, moved);
+	}
+}
+/*		@fn:		link_type createNode(Args&&... args)
+*		@brief:		Takes a node off the free list and constructs its value
+*		@pram:		Args&&... args [in] arguments forwarded to the value's constructor.
+*		@return:	link_type index of the new unlinked node.
+*		@pre:		none.
+*		@post:		The node array doubles when the free list is empty, the new value is built in the new array
+*						before the old values are moved so args may refer to a value of this list*/
+template<typename T_, typename Allocator_>
+template<typename... Args>
+typename compact_dlist<T_, Allocator_>::link_type compact_dlist<T_, Allocator_>::createNode(Args&&... args){
+	node_type* nodes = nodes_;
+	link_type node = free_;
+	link_type capacity = capacity_;
+	if(node == 0){
+		assert(capacity_ < static_cast<link_type>(-1) / 2);
+		capacity = capacity_ < 4 ? 8 : capacity_ * 2;
+		nodes = node_traits::allocate(alloc_, capacity);
+		node = capacity_;
+	}
+	try{
+		::new(static_cast<void*>(&nodes[node].elem_)) value_type(std::forward<Args>(args)...);
+	}catch(...){
+		if(nodes != nodes_)
+			node_traits::deallocate(alloc_, nodes, capacity);
+		throw;
+	}
+	if(nodes != nodes_)
+		grow(nodes, capacity);
+	free_ = nodes_[node].next_;
+	return node;
+}
+/*		@fn:		void destroyNode(link_type node)
+*		@brief:		Destroys a node's value and puts the node on the free list
+*		@pram:		link_type node [in] unlinked node.
+*		@return:	void.
+*		@pre:		node must hold a value
+*		@post:		The node is the first one reused*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::destroyNode(typename compact_dlist<T_, Allocator_>::link_type node){
+	nodes_[node].value().~value_type();
+	nodes_[node].next_ = free_;
+	free_ = node;
+}
+/*		@fn:		void link(link_type position, link_type node)
+*		@brief:		Links node in front of position
+*		@pram:		link_type position [in] node to link in front of.
+*					link_type node [in] unlinked node.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		Only the links of the three nodes are written*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::link(typename compact_dlist<T_, Allocator_>::link_type position, typename compact_dlist<T_, Allocator_>::link_type node){
+	link_type prev = nodes_[position].prev_;
+	nodes_[node].prev_ = prev;
+	nodes_[node].next_ = position;
+	nodes_[prev].next_ = node;
+	nodes_[position].prev_ = node;
+}
+/*		@fn:		void unlink(link_type node)
+*		@brief:		Unlinks node from its neighbours
+*		@pram:		link_type node [in] linked node other than the head.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The neighbours are linked to each other*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::unlink(typename compact_dlist<T_, Allocator_>::link_type node){
+	nodes_[nodes_[node].prev_].next_ = nodes_[node].next_;
+	nodes_[nodes_[node].next_].prev_ = nodes_[node].prev_;
+}
+/*		@fn:		void grow(node_type* nodes, link_type capacity)
+*		@brief:		Moves the list into a larger node array
+*		@pram:		node_type* nodes [in] new node array, slots past the old capacity may already hold a value.
+*					link_type capacity [in] size of the new node array.
+*		@return:	void.
+*		@pre:		capacity must be larger than the old capacity.
+*		@post:		Every node keeps its index so iterators stay valid, the new slots are put on the free list*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::grow(typename compact_dlist<T_, Allocator_>::node_type* nodes, typename compact_dlist<T_, Allocator_>::link_type capacity){
+	if(nodes_ == nullptr){
+		nodes[0].next_ = 0;
+		nodes[0].prev_ = 0;
+	} else {
+		for(link_type node = 0; node < capacity_; ++node){
+			nodes[node].next_ = nodes_[node].next_;
+			nodes[node].prev_ = nodes_[node].prev_;
+		}
+		for(link_type node = nodes_[0].next_; node != 0; node = nodes_[node].next_){
+			::new(static_cast<void*>(&nodes[node].elem_)) value_type(std::move(nodes_[node].value()));
+			nodes_[node].value().~value_type();
+		}
+		node_traits::deallocate(alloc_, nodes_, capacity_);
+	}
+	for(link_type node = capacity - 1; node >= (capacity_ ? capacity_ : 1) && node != 0; --node){
+		nodes[node].next_ = free_;
+		free_ = node;
+	}
+	nodes_ = nodes;
+	capacity_ = capacity;
+}
+/*		@fn:		void dispose()
+*		@brief:		Destroys every value and gives the node array back to the allocator
+*		@pram:		none.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The list holds no node array*/
+template<typename T_, typename Allocator_>
+void compact_dlist<T_, Allocator_>::dispose(){
+	if(nodes_ == nullptr)
+		return;
+	clear();
+	node_traits::deallocate(alloc_, nodes_, capacity_);
+	nodes_ = nullptr;
+	capacity_ = 0;
+	free_ = 0;
+}
+
+template<typename T_, typename Allocator_>
+class compact_dlist_iterator : public std::iterator<std::bidirectional_iterator_tag, T_>
+{
+	//Allow The Following class to access compact_dlist_iterator private members
+	template<typename U_, typename A_> friend class compact_dlist;
+	template<typename U_, typename A_> friend class const_compact_dlist_iterator;
+public:
+	typedef typename compact_dlist<T_, Allocator_>::link_type link_type;
+
+	compact_dlist_iterator() : node_(0), list_(nullptr){ }
+	compact_dlist_iterator(link_type node, compact_dlist<T_, Allocator_>* list) : node_(node), list_(list){}
+
+	compact_dlist_iterator& operator++(){node_ = list_->nodes_[node_].next_; return *this;}
+	compact_dlist_iterator operator++(int){compact_dlist_iterator temp(*this); ++*this; return temp;}
+	compact_dlist_iterator& operator--(){node_ = list_->nodes_[node_].prev_; return *this;}
+	compact_dlist_iterator operator--(int){compact_dlist_iterator temp(*this); --*this; return temp;}
+
+	T_& operator*() const{assert(!(node_ == 0)); return list_->nodes_[node_].value();}
+	T_* operator->() const{return &**this;}
+	bool operator==(compact_dlist_iterator const& rhs) const{return node_ == rhs.node_ && list_ == rhs.list_;}
+	bool operator!=(compact_dlist_iterator const& rhs) const{return !(*this == rhs);}
+private:
+	link_type node_;
+	compact_dlist<T_, Allocator_>* list_;
+};
+
+template<typename T_, typename Allocator_>
+class const_compact_dlist_iterator : public std::iterator<std::bidirectional_iterator_tag, T_, std::ptrdiff_t, T_ const*, T_ const&>
+{
+	//Allow The Following class to access const_compact_dlist_iterator private members
+	template<typename U_, typename A_> friend class compact_dlist;
+public:
+	typedef typename compact_dlist<T_, Allocator_>::link_type link_type;
+
+	const_compact_dlist_iterator() : node_(0), list_(nullptr){ }
+	const_compact_dlist_iterator(link_type node, compact_dlist<T_, Allocator_> const* list) : node_(node), list_(list){}
+	const_compact_dlist_iterator(compact_dlist_iterator<T_, Allocator_> const& iter) : node_(iter.node_), list_(iter.list_){}
+
+	const_compact_dlist_iterator& operator++(){node_ = list_->nodes_[node_].next_; return *this;}
+	const_compact_dlist_iterator operator++(int){const_compact_dlist_iterator temp(*this); ++*this; return temp;}
+	const_compact_dlist_iterator& operator--(){node_ = list_->nodes_[node_].prev_; return *this;}
+	const_compact_dlist_iterator operator--(int){const_compact_dlist_iterator temp(*this); --*this; return temp;}
+
+	T_ const& operator*() const{assert(!(node_ == 0)); return list_->nodes_[node_].value();}
+	T_ const* operator->() const{return &**this;}
+	bool operator==(const_compact_dlist_iterator const& rhs) const{return node_ == rhs.node_ && list_ == rhs.list_;}
+	bool operator!=(const_compact_dlist_iterator const& rhs) const{return !(*this == rhs);}
+private:
+	link_type node_;
+	compact_dlist<T_, Allocator_> const* list_;
+};
+#endif
@@ -16,28 +16,34 @@
 #include <iterator>
 #include <algorithm>
 #include <cassert>
+#include <utility>
+#include <memory>
 //Forward Declaration
-template<typename T_> class dlist;
-template<typename T_> class dlist_iterator;
-template<typename T_> class const_dlist_iterator;
+template<typename T_, typename Allocator_ = std::allocator<T_>> class dlist;
+template<typename T_, typename Allocator_ = std::allocator<T_>> class dlist_iterator;
+template<typename T_, typename Allocator_ = std::allocator<T_>> class const_dlist_iterator;
 
 template<typename T_>
 class dlist_node{
 	//Allow The Following class to access dlist_node private members
-	template<typename T_> friend class dlist;
-	template<typename T_> friend class dlist_iterator;
-	template<typename T_> friend class const_dlist_iterator;
+	template<typename U_, typename A_> friend class dlist;
+	template<typename U_, typename A_> friend class dlist_iterator;
+	template<typename U_, typename A_> friend class const_dlist_iterator;
 
 public:
 	typedef T_				value_type;
 	typedef T_&				reference_type;
 	typedef T_ const&		const_reference_type;
 	typedef dlist_node<T_>*	ptr_type;
+	struct emplace_tag{};
 
 	explicit dlist_node(const_reference_type data) : elem_(data), next_(0), prev_(0){ }
+	explicit dlist_node(value_type&& data) : elem_(std::move(data)), next_(0), prev_(0){ }
+	template<typename... Args>
+	dlist_node(emplace_tag, Args&&... args) : elem_(std::forward<Args>(args)...), next_(0), prev_(0){ }
 	dlist_node(dlist_node<value_type> const& node) :  elem_(node.elem_), next_(node.next_), prev_(node.prev_){ }
 	dlist_node() : next_(0), prev_(0){}
-	virtual ~dlist_node(){};
+	~dlist_node(){}
 
 	dlist_node& operator=( dlist_node const& node);
 
@@ -64,32 +70,36 @@ dlist_node<T_>& dlist_node<T_>::operator=(dlist_node const& rhs)
 	return *this;
 }
 
-template<typename T_>
+template<typename T_, typename Allocator_>
 class dlist{
 	//Allow The Following class to access dlist private members
-	template<typename T_> friend class dlist_iterator;
-	template<typename T_> friend class const_dlist_iterator;
+	template<typename U_, typename A_> friend class dlist_iterator;
+	template<typename U_, typename A_> friend class const_dlist_iterator;
 public:
 	typedef std::size_t			size_type;
 	typedef std::ptrdiff_t		difference_type;
 	typedef T_					value_type;
 	typedef T_&					reference_type;
 	typedef T_ const&			const_reference_type;
-	typedef dlist<T_>			ptr_type;
+	typedef Allocator_			allocator_type;
+	typedef dlist<T_, Allocator_>			ptr_type;
 	typedef dlist_node<T_>		node_type;
-	typedef dlist_iterator<T_>	iterator;
-	typedef const_dlist_iterator<T_> const_iterator;	
+	typedef dlist_iterator<T_, Allocator_>	iterator;
+	typedef const_dlist_iterator<T_, Allocator_> const_iterator;	
 	typedef std::reverse_iterator<iterator> reverse_iterator;
 	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 	
 	dlist();
-	dlist(dlist<value_type> const& rhs);
-	dlist(dlist<value_type> && rhs);
+	explicit dlist(allocator_type const& alloc);
+	dlist(dlist<T_, Allocator_> const& rhs);
+	dlist(dlist<T_, Allocator_> && rhs);
 	dlist& operator=( dlist && list);
 	virtual ~dlist();
+
+	allocator_type get_allocator() const{return allocator_type(alloc_);}
 	
-	bool operator==(dlist<T_> & rhs);
-	bool operator!=(dlist<T_> & rhs);
+	bool operator==(dlist<T_, Allocator_> & rhs);
+	bool operator!=(dlist<T_, Allocator_> & rhs);
 
 	iterator begin(){return iterator(head_->next_, this);}
 	const_iterator begin()const{return const_iterator(head_->next_, this);}
@@ -113,17 +123,36 @@ public:
 	bool empty(){return size_ == 0;}
 	void clear();
 	void push_back(const_reference_type value);
+	void push_back(value_type&& value);
 	void push_front(const_reference_type value);
+	void push_front(value_type&& value);
+	template<typename... Args>
+	void emplace_back(Args&&... args);
+	template<typename... Args>
+	void emplace_front(Args&&... args);
 	void pop_back();
 	void pop_front();
 
 	iterator insert( const iterator position, const_reference_type x);
+	iterator insert( const iterator position, value_type&& x);
+	template<typename... Args>
+	iterator emplace( const iterator position, Args&&... args);
 	iterator erase(iterator& position);
+	void splice( const iterator position, dlist<T_, Allocator_>& other);
+	void splice( const iterator position, dlist<T_, Allocator_>& other, iterator i);
+	void splice( const iterator position, dlist<T_, Allocator_>& other, iterator first, iterator last);
 private:
+	typedef typename std::allocator_traits<Allocator_>::template rebind_alloc<node_type> node_allocator;
+	typedef std::allocator_traits<node_allocator> node_traits;
+
+	node_allocator alloc_;
 	node_type* head_;
-	node_type* scanner_;
 	size_type size_;
 
+	template<typename... Args>
+	node_type* createNode(Args&&... args);
+	void destroyNode(node_type* node);
+	void transfer(node_type* position, node_type* first, node_type* last);
 	void dispose();
 };
 /*		@fn:	    dlist();
@@ -132,8 +161,19 @@ private:
 *		@return:	none.
 *		@pre:		none.
 *		@post:		A dlist object will be constructed.*/
-template< typename T_>
-dlist<T_>::dlist() : head_(new typename node_type), size_(0){
+template<typename T_, typename Allocator_>
+dlist<T_, Allocator_>::dlist() : head_(createNode()), size_(0){
+	head_->next_ = head_;
+	head_->prev_ = head_;
+}
+/*		@fn:	    dlist(allocator_type const& alloc);
+*		@brief:		allocator constructor
+*		@pram:		allocator_type const& alloc [in] allocator the nodes are taken from.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		A dlist object will be constructed that allocates its nodes through alloc.*/
+template<typename T_, typename Allocator_>
+dlist<T_, Allocator_>::dlist(typename dlist<T_, Allocator_>::allocator_type const& alloc) : alloc_(alloc), head_(createNode()), size_(0){
 	head_->next_ = head_;
 	head_->prev_ = head_;
 }
@@ -143,9 +183,9 @@ dlist<T_>::dlist() : head_(new typename node_type), size_(0){
 *		@return:	none.
 *		@pre:		none.
 *		@post:		A dlist object will be constructed with the prototype of the parameter*/
-template< typename T_>
-dlist<T_>::dlist(dlist<T_> const& rhs){
-	head_ = new node_type;
+template<typename T_, typename Allocator_>
+dlist<T_, Allocator_>::dlist(dlist<T_, Allocator_> const& rhs) : alloc_(node_traits::select_on_container_copy_construction(rhs.alloc_)){
+	head_ = createNode();
 	head_->next_ = head_;
 	head_->prev_ = head_;
 	size_ = 0;
@@ -159,10 +199,9 @@ dlist<T_>::dlist(dlist<T_> const& rhs){
 *		@return:	none.
 *		@pre:		none.
 *		@post:		A dlist object rhs will be  move to this.*/
-template< typename T_>
-dlist<T_>::dlist(dlist<T_> && rhs) : head_(rhs.head_), scanner_(rhs.scanner_), size_(rhs.size_){
+template<typename T_, typename Allocator_>
+dlist<T_, Allocator_>::dlist(dlist<T_, Allocator_> && rhs) : alloc_(std::move(rhs.alloc_)), head_(rhs.head_), size_(rhs.size_){
 	rhs.head_ = nullptr;
-	rhs.scanner_ = nullptr;
 	rhs.size_ = 0;
 
 }
@@ -172,15 +211,13 @@ dlist<T_>::dlist(dlist<T_> && rhs) : head_(rhs.head_), scanner_(rhs.scanner_), s
 *		@return:	dlist<T_>&, reference to the newly initialized object.
 *		@pre:		none.
 *		@post:		A dlist object 'rhs' will be  move to this*/
-template< typename T_>
-dlist<T_>& dlist<T_>::operator=(dlist<T_> && rhs){
+template<typename T_, typename Allocator_>
+dlist<T_, Allocator_>& dlist<T_, Allocator_>::operator=(dlist<T_, Allocator_> && rhs){
 	dispose();
+	this->alloc_ = std::move(rhs.alloc_);
 	this->head_ = rhs.head_;
 	rhs.head_ = nullptr;
 	
-	this->scanner_ = rhs.scanner_;
-	rhs.scanner_ = nullptr;
-	
 	this->size_ = rhs.size_;
 	rhs.size_ = 0;
 
@@ -192,8 +229,8 @@ dlist<T_>& dlist<T_>::operator=(dlist<T_> && rhs){
 *		@return:		none.
 *		@pre:		none.
 *		@post:		object of dlist will be destructed*/
-template< typename T_>
-dlist<T_>::~dlist(){
+template<typename T_, typename Allocator_>
+dlist<T_, Allocator_>::~dlist(){
 	dispose();
 }
 /*		@fn:		bool operator==(dlist<T_> const& lhs);
@@ -202,8 +239,8 @@ dlist<T_>::~dlist(){
 *		@return:	bool indicating whether or not the values are the same
 *		@pre:		none.
 *		@post:		indication of whether or not the values are the same.*/
-template< typename T_>
-bool dlist<T_>::operator==(dlist<T_> & rhs){
+template<typename T_, typename Allocator_>
+bool dlist<T_, Allocator_>::operator==(dlist<T_, Allocator_> & rhs){
 	return (this->size() == rhs.size() && std::equal(this->cbegin(), this->cend(), rhs.cbegin()));
 }
 /*		@fn:		bool operator!=(dlist<T_> const& lhs);
@@ -212,8 +249,8 @@ bool dlist<T_>::operator==(dlist<T_> & rhs){
 *		@return:	bool indicating whether or not the values are different
 *		@pre:		none.
 *		@post:		indication of whether or not the values are different*/
-template< typename T_>
-bool dlist<T_>::operator!=(dlist<T_> & rhs){
+template<typename T_, typename Allocator_>
+bool dlist<T_, Allocator_>::operator!=(dlist<T_, Allocator_> & rhs){
 	return !(*this == rhs);
 }
 /*		@fn:        void push_back(const_reference_type value);
@@ -222,13 +259,13 @@ bool dlist<T_>::operator!=(dlist<T_> & rhs){
 *		@return:		void.
 *		@pre:		the value parameter must be the same type as the dlist
 *		@post:		a value node is added to the back of list*/
-template< typename T_>
-void dlist<T_>::push_back(typename dlist<T_>::const_reference_type value){
-	node_type* item = new node_type(value);
-	scanner_ = head_->prev_;
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::push_back(typename dlist<T_, Allocator_>::const_reference_type value){
+	node_type* item = createNode(value);
+	node_type* last = head_->prev_;
 	item->next_ = head_;
-	item->prev_ = scanner_;
-	scanner_->next_ = item;
+	item->prev_ = last;
+	last->next_ = item;
 	head_->prev_ = item;
 
 
@@ -240,33 +277,75 @@ void dlist<T_>::push_back(typename dlist<T_>::const_reference_type value){
 *		@return:		void.
 *		@pre:		the value parameter must be the same type as the dlist
 *		@post:		a value node is added to the front of list.*/
-template< typename T_>
-void dlist<T_>::push_front(typename dlist<T_>::const_reference_type value){
-	node_type* item = new node_type(value);
-	scanner_ = head_->next_;
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::push_front(typename dlist<T_, Allocator_>::const_reference_type value){
+	node_type* item = createNode(value);
+	node_type* first = head_->next_;
 	item->prev_ = head_;
-	item->next_ = scanner_;
-	scanner_->prev_ = item;
+	item->next_ = first;
+	first->prev_ = item;
 	head_->next_ = item;
 
 	++size_;
 }
+/*		@fn:        void push_back(value_type&& value);
+*		@brief:		Moves a value into a new node at the head_'s prev_ member
+*		@pram:		value_type&& value [in] value to be moved into the node.
+*		@return:		void.
+*		@pre:		None.
+*		@post:		a value node is added to the back of list*/
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::push_back(typename dlist<T_, Allocator_>::value_type&& value){
+	emplace(end(), std::move(value));
+}
+/*		@fn:        void push_front(value_type&& value);
+*		@brief:		Moves a value into a new node at the head_'s next_ member
+*		@pram:		value_type&& value [in] value to be moved into the node.
+*		@return:		void.
+*		@pre:		None.
+*		@post:		a value node is added to the front of list.*/
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::push_front(typename dlist<T_, Allocator_>::value_type&& value){
+	emplace(begin(), std::move(value));
+}
+/*		@fn:        void emplace_back(Args&&... args);
+*		@brief:		Constructs a value in a new node at the head_'s prev_ member
+*		@pram:		Args&&... args [in] arguments forwarded to the value's constructor.
+*		@return:		void.
+*		@pre:		None.
+*		@post:		a value node is added to the back of list*/
+template<typename T_, typename Allocator_>
+template< typename... Args>
+void dlist<T_, Allocator_>::emplace_back(Args&&... args){
+	emplace(end(), std::forward<Args>(args)...);
+}
+/*		@fn:        void emplace_front(Args&&... args);
+*		@brief:		Constructs a value in a new node at the head_'s next_ member
+*		@pram:		Args&&... args [in] arguments forwarded to the value's constructor.
+*		@return:		void.
+*		@pre:		None.
+*		@post:		a value node is added to the front of list.*/
+template<typename T_, typename Allocator_>
+template< typename... Args>
+void dlist<T_, Allocator_>::emplace_front(Args&&... args){
+	emplace(begin(), std::forward<Args>(args)...);
+}
 /*		@fn:        void :pop_back()
 *		@brief:		removes a node from the head_'s prev_ member
 *		@pram:		none.
 *		@return:		void.
 *		@pre:		There must be at least one node, other than the head, in the dlist
 *		@post:		a value node is removed from the back of list*/
-template< typename T_>
-void dlist<T_>::pop_back(){
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::pop_back(){
 	assert(!(size_ == 0));
 	assert(!(head_->prev_ == head_ || head_->next_ == head_));
 
 	node_type* item = head_->prev_;
-	scanner_ = head_->prev_->prev_;
-	scanner_->next_ = head_;
-	head_->prev_ = scanner_;
-	delete item;
+	node_type* last = item->prev_;
+	last->next_ = head_;
+	head_->prev_ = last;
+	destroyNode(item);
 	--size_;
 }
 /*		@fn:        void :pop_front()
@@ -275,42 +354,73 @@ void dlist<T_>::pop_back(){
 *		@return:		void.
 *		@pre:		There must be at least one node, other than the head, in the dlist
 *		@post:		a value node is removed from the front of list*/
-template< typename T_>
-void dlist<T_>::pop_front(){
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::pop_front(){
 	assert(!(size_ == 0));
 	assert(!(head_->prev_ == head_ || head_->next_ == head_));
 
 	node_type* item = head_->next_;
-	scanner_ = head_->next_->next_;
-	scanner_->prev_ = head_;
-	head_->next_ = scanner_;
-	delete item;
+	node_type* first = item->next_;
+	first->prev_ = head_;
+	head_->next_ = first;
+	destroyNode(item);
 	--size_;
 }
+/*		@fn:		node_type* createNode(Args&&... args)
+*		@brief:		Allocates a node through the list's allocator and constructs it
+*		@pram:		Args&&... args [in] arguments forwarded to the node's constructor.
+*		@return:	node_type* the new unlinked node.
+*		@pre:		none.
+*		@post:		The node must be given back through destroyNode*/
+template<typename T_, typename Allocator_>
+template<typename... Args>
+typename dlist<T_, Allocator_>::node_type* dlist<T_, Allocator_>::createNode(Args&&... args){
+	node_type* node = node_traits::allocate(alloc_, 1);
+	try{
+		node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+	}catch(...){
+		node_traits::deallocate(alloc_, node, 1);
+		throw;
+	}
+	return node;
+}
+/*		@fn:		void destroyNode(node_type* node)
+*		@brief:		Destroys a node and gives its memory back to the list's allocator
+*		@pram:		node_type* node [in] unlinked node, may be null.
+*		@return:	void.
+*		@pre:		node must have come from createNode
+*		@post:		The node is destroyed*/
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::destroyNode(typename dlist<T_, Allocator_>::node_type* node){
+	if(node == nullptr)
+		return;
+	node_traits::destroy(alloc_, node);
+	node_traits::deallocate(alloc_, node, 1);
+}
 /*		@fn:		void dispose()
 *		@brief:		Cleans up all the dynamic memory/raw pointers
 *		@pram:		none.
 *		@return:	void.
 *		@pre:		a dlist object must have been created
 *		@post:		All the dynamic memory is cleaned up*/
-template< typename T_>
-void dlist<T_>::dispose(){
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::dispose(){
 	node_type* item = (node_type *)0;
 
 	if(size_ == 0){
-		delete head_;
+		destroyNode(head_);
 		return;
 	}
 
-	scanner_ = head_->next_;
-	while ( scanner_ != head_ ) {
-		item = scanner_;
-		scanner_ = scanner_->next_;
-		delete item;
+	node_type* scanner = head_->next_;
+	while ( scanner != head_ ) {
+		item = scanner;
+		scanner = scanner->next_;
+		destroyNode(item);
 	}
 	item = head_;
 
-	delete item;
+	destroyNode(item);
 }
 /*		@fn:		void clear()
 *		@brief:		Empties all of dlist's nodes
@@ -319,13 +429,13 @@ void dlist<T_>::dispose(){
 *		@pre:		a dlist object must have been created
 *		@post:		All the dynamic memory is cleaned up and dlist will only 
 					contain the head_ node*/
-template< typename T_>
-void dlist<T_>::clear(){
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::clear(){
 	if(this->size() == 0)
 		return;
 
 	dispose();
-	head_ = new node_type();
+	head_ = createNode();
 	head_->next_ = head_;
 	head_->prev_ = head_;
 	size_ = 0;
@@ -336,8 +446,8 @@ void dlist<T_>::clear(){
 *		@return:	reference [in] reference to the first element in the list
 *		@pre:	    There must be at least one element in the list
 *		@post:		The first element is returned to the client.*/
-template< typename T_>
-typename dlist<T_>::reference_type dlist<T_>::front(){
+template<typename T_, typename Allocator_>
+typename dlist<T_, Allocator_>::reference_type dlist<T_, Allocator_>::front(){
 	assert(!(size_ == 0));
 	assert(!(head_->prev_ == head_ || head_->next_ == head_));
 	return this->head_->next_->elem_;
@@ -349,8 +459,8 @@ typename dlist<T_>::reference_type dlist<T_>::front(){
 *		@pre:	    There must be at least one element in the list
 *		@post:		The last element is returned to the client
 *       @invariant  There is a head node linking all the other nodes.*/
-template< typename T_>
-typename dlist<T_>::reference_type dlist<T_>::back(){
+template<typename T_, typename Allocator_>
+typename dlist<T_, Allocator_>::reference_type dlist<T_, Allocator_>::back(){
 	assert(!(size_ == 0));
 	assert(!(head_->prev_ == head_ || head_->next_ == head_));
 	return this->head_->prev_->elem_;
@@ -362,13 +472,44 @@ typename dlist<T_>::reference_type dlist<T_>::back(){
 *		@return:	iterator that points to the newly inserted element.
 *		@pre:	    None
 *		@post:		parameter x is added to the list before the parameter position node*/
-template< typename T_>
-typename dlist<T_>::iterator dlist<T_>::insert(typename const dlist<T_>::iterator position, typename dlist<T_>::const_reference_type x){
+template<typename T_, typename Allocator_>
+typename dlist<T_, Allocator_>::iterator dlist<T_, Allocator_>::insert(typename const dlist<T_, Allocator_>::iterator position, typename dlist<T_, Allocator_>::const_reference_type x){
 	assert(!(this != position.dlist_));
-	node_type* item = new node_type(x);
-	scanner_ = position.node_->prev_;
-	item->prev_ = scanner_;
-	scanner_->next_ = item;
+	node_type* item = createNode(x);
+	node_type* prev = position.node_->prev_;
+	item->prev_ = prev;
+	prev->next_ = item;
+	item->next_ = position.node_;
+	position.node_->prev_ = item;
+	++size_;
+	return iterator(item,this);
+}
+/*		@fn:		iterator insert(iterator position, value_type&& x)
+*		@brief:		The list container is extended by moving a value in before the element at position.
+*		@pram:		iterator position [in] Position in the container where the new element is inserted.
+*					value_type&& x [in] Value to be moved into the inserted element.
+*		@return:	iterator that points to the newly inserted element.
+*		@pre:	    None
+*		@post:		parameter x is moved into the list before the parameter position node*/
+template<typename T_, typename Allocator_>
+typename dlist<T_, Allocator_>::iterator dlist<T_, Allocator_>::insert(const typename dlist<T_, Allocator_>::iterator position, typename dlist<T_, Allocator_>::value_type&& x){
+	return emplace(position, std::move(x));
+}
+/*		@fn:		iterator emplace(iterator position, Args&&... args)
+*		@brief:		The list container is extended by constructing a new element before the element at position.
+*		@pram:		iterator position [in] Position in the container where the new element is constructed.
+*					Args&&... args [in] arguments forwarded to the value's constructor.
+*		@return:	iterator that points to the newly constructed element.
+*		@pre:	    None
+*		@post:		a value built from args is added to the list before the parameter position node*/
+template<typename T_, typename Allocator_>
+template< typename... Args>
+typename dlist<T_, Allocator_>::iterator dlist<T_, Allocator_>::emplace(const typename dlist<T_, Allocator_>::iterator position, Args&&... args){
+	assert(!(this != position.dlist_));
+	node_type* item = createNode(typename node_type::emplace_tag(), std::forward<Args>(args)...);
+	node_type* prev = position.node_->prev_;
+	item->prev_ = prev;
+	prev->next_ = item;
 	item->next_ = position.node_;
 	position.node_->prev_ = item;
 	++size_;
@@ -381,37 +522,137 @@ typename dlist<T_>::iterator dlist<T_>::insert(typename const dlist<T_>::iterato
 *						the last element erased by the method call
 *		@pre:	    There must be at least one element in the list
 *		@post:		parameter position is deleted from the list.*/
-template< typename T_>
-typename dlist<T_>::iterator dlist<T_>::erase(typename dlist<T_>::iterator &position){
+template<typename T_, typename Allocator_>
+typename dlist<T_, Allocator_>::iterator dlist<T_, Allocator_>::erase(typename dlist<T_, Allocator_>::iterator &position){
 	assert(!(size_ == 0));
 	assert(!(head_->prev_ == head_ || head_->next_ == head_));
 	assert(!(head_ == position.node_ ));
 	assert(!(this != position.dlist_));
 
-	scanner_ = position.node_->next_;
-	position.node_->prev_->next_ = scanner_; 
-	scanner_->prev_ = position.node_->prev_;
-	delete position.node_;
+	node_type* next = position.node_->next_;
+	position.node_->prev_->next_ = next; 
+	next->prev_ = position.node_->prev_;
+	destroyNode(position.node_);
 	--size_;
-	return iterator(scanner_, this);
+	return iterator(next, this);
+}
+/*		@fn:		void splice(iterator position, dlist& other)
+*		@brief:		Moves every node of other in front of position
+*		@pram:		iterator position [in] Position in this list the nodes are linked in front of.
+*					dlist& other [in/out] list giving up its nodes, may not be this list.
+*		@return:	void.
+*		@pre:	    position must belong to this list
+*		@post:		other is empty, no node is allocated, freed or copied. Iterators to the moved nodes
+*						still reference them but must be obtained again before being compared to this list's iterators.
+*						When the allocators differ the values are moved into new nodes instead*/
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::splice(const typename dlist<T_, Allocator_>::iterator position, dlist<T_, Allocator_>& other){
+	assert(!(this != position.dlist_));
+	if(this == &other || other.size_ == 0)
+		return;
+	if(!(this->alloc_ == other.alloc_)){
+		splice(position, other, other.begin(), other.end());
+		return;
+	}
+	transfer(position.node_, other.head_->next_, other.head_);
+	size_ += other.size_;
+	other.size_ = 0;
+}
+/*		@fn:		void splice(iterator position, dlist& other, iterator i)
+*		@brief:		Moves the node at i from other in front of position
+*		@pram:		iterator position [in] Position in this list the node is linked in front of.
+*					dlist& other [in/out] list holding i, may be this list.
+*					iterator i [in] node to be moved.
+*		@return:	void.
+*		@pre:	    position must belong to this list and i must reference a value of other
+*		@post:		The node is relinked in constant time, no node is allocated, freed or copied.
+*						A node may only be relinked into a list whose allocator can free it, so when the
+*						allocators differ the value is moved into a new node and the old node is freed by other*/
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::splice(const typename dlist<T_, Allocator_>::iterator position, dlist<T_, Allocator_>& other, typename dlist<T_, Allocator_>::iterator i){
+	assert(!(this != position.dlist_));
+	assert(!(&other != i.dlist_));
+	assert(!(other.head_ == i.node_));
+	if(i.node_ == position.node_ || i.node_->next_ == position.node_)
+		return;
+	if(this != &other && !(this->alloc_ == other.alloc_)){
+		emplace(position, std::move(*i));
+		other.erase(i);
+		return;
+	}
+	transfer(position.node_, i.node_, i.node_->next_);
+	--other.size_;
+	++size_;
+}
+/*		@fn:		void splice(iterator position, dlist& other, iterator first, iterator last)
+*		@brief:		Moves the nodes in [first, last) from other in front of position
+*		@pram:		iterator position [in] Position in this list the nodes are linked in front of.
+*					dlist& other [in/out] list holding the range, may be this list.
+*					iterator first [in] first node to be moved.
+*					iterator last [in] one past the last node to be moved.
+*		@return:	void.
+*		@pre:	    position must belong to this list and not be inside the range, the range must belong to other
+*		@post:		The range is relinked in constant time. Between two different lists the range is
+*						walked once to keep both sizes, as std::list does, and when the allocators differ
+*						its values are moved into new nodes one at a time*/
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::splice(const typename dlist<T_, Allocator_>::iterator position, dlist<T_, Allocator_>& other, typename dlist<T_, Allocator_>::iterator first, typename dlist<T_, Allocator_>::iterator last){
+	assert(!(this != position.dlist_));
+	assert(!(&other != first.dlist_ || &other != last.dlist_));
+	if(first.node_ == last.node_ || position.node_ == last.node_)
+		return;
+	if(this != &other && !(this->alloc_ == other.alloc_)){
+		while(first.node_ != last.node_){
+			emplace(position, std::move(*first));
+			first = other.erase(first);
+		}
+		return;
+	}
+	if(this != &other){
+		size_type count = 0;
+		for(node_type* node = first.node_; node != last.node_; node = node->next_)
+			++count;
+		other.size_ -= count;
+		size_ += count;
+	}
+	transfer(position.node_, first.node_, last.node_);
 }
+/*		@fn:		void transfer(node_type* position, node_type* first, node_type* last)
+*		@brief:		Unlinks the nodes in [first, last) and links them in front of position
+*		@pram:		node_type* position [in] node the range is linked in front of.
+*					node_type* first [in] first node to be moved.
+*					node_type* last [in] one past the last node to be moved.
+*		@return:	void.
+*		@pre:	    The range must not be empty and position must not be inside it
+*		@post:		Only the links around the three positions are written, sizes are left to the caller*/
+template<typename T_, typename Allocator_>
+void dlist<T_, Allocator_>::transfer(typename dlist<T_, Allocator_>::node_type* position, typename dlist<T_, Allocator_>::node_type* first, typename dlist<T_, Allocator_>::node_type* last){
+	node_type* tail = last->prev_;
+	first->prev_->next_ = last;
+	last->prev_ = first->prev_;
 
-template<typename T_>
+	first->prev_ = position->prev_;
+	position->prev_->next_ = first;
+	tail->next_ = position;
+	position->prev_ = tail;
+}
+
+template<typename T_, typename Allocator_>
 class dlist_iterator : public std::iterator<std::bidirectional_iterator_tag, T_>
 {
 	//Allow The Following class to access dlist_iterator private members
-	template<typename T_> friend class dlist;
-	template<typename T_> friend class const_dlist_iterator;
+	template<typename U_, typename A_> friend class dlist;
+	template<typename U_, typename A_> friend class const_dlist_iterator;
 public:
 	typedef dlist_node<T_>* node_ptr;
-	typedef dlist<T_>* dlist;
+	typedef dlist<T_, Allocator_>* dlist;
 
 	dlist_iterator(){ }
 	dlist_iterator(node_ptr node, dlist myList ) : dlist_(myList), node_(node){}
-	dlist_iterator(dlist_iterator<T_> const& iter) : dlist_(iter.dlist_), node_(iter.node_){}
+	dlist_iterator(dlist_iterator<T_, Allocator_> const& iter) : dlist_(iter.dlist_), node_(iter.node_){}
 	~dlist_iterator();
 	
-	dlist_iterator<T_>& operator=(dlist_iterator<T_> const& lhs);
+	dlist_iterator<T_, Allocator_>& operator=(dlist_iterator<T_, Allocator_> const& lhs);
 	dlist_iterator& operator++();
 	dlist_iterator operator++(int);
 	dlist_iterator& operator--();
@@ -419,8 +660,8 @@ public:
 	
 	reference operator*();
 	const reference operator*() const;
-	bool operator==(dlist_iterator<T_> const& lhs) const;
-	bool operator!=(dlist_iterator<T_> const& lhs) const;
+	bool operator==(dlist_iterator<T_, Allocator_> const& lhs) const;
+	bool operator!=(dlist_iterator<T_, Allocator_> const& lhs) const;
 
 private:
 	node_ptr node_;
@@ -432,8 +673,8 @@ private:
 *		@return:	none.
 *		@pre:		none.
 *		@post:		Object is destructed*/
-template<typename T_>
-dlist_iterator<T_>::~dlist_iterator(){
+template<typename T_, typename Allocator_>
+dlist_iterator<T_, Allocator_>::~dlist_iterator(){
 	node_ = nullptr;
 	dlist_ = nullptr;
 }
@@ -443,8 +684,8 @@ dlist_iterator<T_>::~dlist_iterator(){
 *		@return:	dlist_iterator& newly assigned object
 *		@pre:		None
 *		@post:		this contains the private members of lhs*/
-template<typename T_>
-typename dlist_iterator<T_>& dlist_iterator<T_>::operator=(typename dlist_iterator<T_> const& lhs){
+template<typename T_, typename Allocator_>
+typename dlist_iterator<T_, Allocator_>& dlist_iterator<T_, Allocator_>::operator=(typename dlist_iterator<T_, Allocator_> const& lhs){
 	this->dlist_ = lhs.dlist_;
 	this->node_ = lhs.node_;
 	return *this;
@@ -455,8 +696,8 @@ typename dlist_iterator<T_>& dlist_iterator<T_>::operator=(typename dlist_iterat
 *		@return:	dlist_iterator<T_> of the incremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is incremented*/
-template<typename T_>
-typename dlist_iterator<T_>& dlist_iterator<T_>::operator++(){
+template<typename T_, typename Allocator_>
+typename dlist_iterator<T_, Allocator_>& dlist_iterator<T_, Allocator_>::operator++(){
 	assert(!(node_ == dlist_->head_));
 	node_ = node_->next_;
 	return *this;
@@ -467,9 +708,9 @@ typename dlist_iterator<T_>& dlist_iterator<T_>::operator++(){
 *		@return:	dlist_iterator<T_> of the incremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is incremented*/
-template<typename T_>
-typename dlist_iterator<T_> dlist_iterator<T_>::operator++(int){
-	dlist_iterator<T_> temp = *this;
+template<typename T_, typename Allocator_>
+typename dlist_iterator<T_, Allocator_> dlist_iterator<T_, Allocator_>::operator++(int){
+	dlist_iterator<T_, Allocator_> temp = *this;
 	++*this;
 	return (temp);
 }
@@ -479,8 +720,8 @@ typename dlist_iterator<T_> dlist_iterator<T_>::operator++(int){
 *		@return:	dlist_iterator<T_> of the decremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is decremented*/
-template<typename T_>
-typename  dlist_iterator<T_>& dlist_iterator<T_>::operator--(){
+template<typename T_, typename Allocator_>
+typename  dlist_iterator<T_, Allocator_>& dlist_iterator<T_, Allocator_>::operator--(){
 	assert(!(node_ == dlist_->head_->next_));
 	node_ = node_->prev_;
 	return *this;
@@ -491,9 +732,9 @@ typename  dlist_iterator<T_>& dlist_iterator<T_>::operator--(){
 *		@return:	dlist_iterator<T_> of the decremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is decremented*/
-template<typename T_>
-typename dlist_iterator<T_> dlist_iterator<T_>::operator--(int){
-	dlist_iterator<T_> temp = *this;
+template<typename T_, typename Allocator_>
+typename dlist_iterator<T_, Allocator_> dlist_iterator<T_, Allocator_>::operator--(int){
+	dlist_iterator<T_, Allocator_> temp = *this;
 	--*this;
 	return (temp);
 }
@@ -503,8 +744,8 @@ typename dlist_iterator<T_> dlist_iterator<T_>::operator--(int){
 *		@return:	a reference to the value type
 *		@pre:		Parameter object must have been constructed
 *		@post:		Returns a reference to the value type*/
-template<typename T_>
-typename dlist_iterator<T_>::reference dlist_iterator<T_>::operator*(){
+template<typename T_, typename Allocator_>
+typename dlist_iterator<T_, Allocator_>::reference dlist_iterator<T_, Allocator_>::operator*(){
 	assert(!(node_ == dlist_->head_));
 	return node_->elem_;
 }
@@ -514,8 +755,8 @@ typename dlist_iterator<T_>::reference dlist_iterator<T_>::operator*(){
 *		@return:	a constant reference to the value type
 *		@pre:		Parameter object must have been constructed 
 *		@post:		Returns a constant reference to the value type*/
-template<typename T_>
-typename const dlist_iterator<T_>::reference dlist_iterator<T_>::operator*() const{
+template<typename T_, typename Allocator_>
+typename const dlist_iterator<T_, Allocator_>::reference dlist_iterator<T_, Allocator_>::operator*() const{
 	assert(!(node_ == dlist_->head_));
 	return node_->elem_;
 }
@@ -525,8 +766,8 @@ typename const dlist_iterator<T_>::reference dlist_iterator<T_>::operator*() con
 *		@return:	bool indicating if they are the same
 *		@pre:		Parameter object must have been constructed
 *		@post:		client receives bool indicating if they are the same*/
-template<typename T_>
-bool dlist_iterator<T_>::operator==(typename dlist_iterator<T_> const& lhs) const{
+template<typename T_, typename Allocator_>
+bool dlist_iterator<T_, Allocator_>::operator==(typename dlist_iterator<T_, Allocator_> const& lhs) const{
 	return this->node_->elem_ == lhs.node_->elem_ && this->node_ == lhs.node_ && this->dlist_ == lhs.dlist_ ;
 }
 /*		@fn:		bool operator!=(dlist_iterator<T_> const& rhs) const
@@ -535,29 +776,29 @@ bool dlist_iterator<T_>::operator==(typename dlist_iterator<T_> const& lhs) cons
 *		@return:	bool indicating if they are different
 *		@pre:		Parameter object must have been constructed
 *		@post:		client receives bool indicating if they are different*/
-template<typename T_>
-bool dlist_iterator<T_>::operator!=(typename dlist_iterator<T_> const& lhs) const{
+template<typename T_, typename Allocator_>
+bool dlist_iterator<T_, Allocator_>::operator!=(typename dlist_iterator<T_, Allocator_> const& lhs) const{
 	return !(*this == lhs);
 }
-template<typename T_>
+template<typename T_, typename Allocator_>
 class const_dlist_iterator : public std::iterator<std::bidirectional_iterator_tag, T_, std::ptrdiff_t, const T_*, const T_&>
 {
 public:
 	typedef const dlist_node<T_>* node_ptr;
-	typedef const dlist<T_>* dlist;
+	typedef const dlist<T_, Allocator_>* dlist;
 	const_dlist_iterator(){ }
 	const_dlist_iterator(node_ptr node, dlist myList ) : dlist_(myList), node_(node){}
-	const_dlist_iterator( const_dlist_iterator<T_> const& iter) : dlist_(iter.dlist_), node_(iter.node_){}
-	const_dlist_iterator( dlist_iterator<T_> const& iter) : dlist_(iter.dlist_), node_(iter.node_){}
+	const_dlist_iterator( const_dlist_iterator<T_, Allocator_> const& iter) : dlist_(iter.dlist_), node_(iter.node_){}
+	const_dlist_iterator( dlist_iterator<T_, Allocator_> const& iter) : dlist_(iter.dlist_), node_(iter.node_){}
 	~const_dlist_iterator();
-	const_dlist_iterator<T_>& operator=(const_dlist_iterator<T_> const& lhs);
+	const_dlist_iterator<T_, Allocator_>& operator=(const_dlist_iterator<T_, Allocator_> const& lhs);
 	const_dlist_iterator& operator++();
 	const_dlist_iterator operator++(int);
 	const_dlist_iterator& operator--();
 	const_dlist_iterator operator--(int);
 	const reference operator*() const;
-	bool operator==(const_dlist_iterator<T_> const& lhs) const;
-	bool operator!=(const_dlist_iterator<T_> const& lhs) const;
+	bool operator==(const_dlist_iterator<T_, Allocator_> const& lhs) const;
+	bool operator!=(const_dlist_iterator<T_, Allocator_> const& lhs) const;
 
 private:
 	node_ptr node_;
@@ -569,8 +810,8 @@ private:
 *		@return:	none.
 *		@pre:		none.
 *		@post:		Object is destructed*/
-template<typename T_>
-const_dlist_iterator<T_>::~const_dlist_iterator(){
+template<typename T_, typename Allocator_>
+const_dlist_iterator<T_, Allocator_>::~const_dlist_iterator(){
 	node_ = nullptr;
 	dlist_ = nullptr;
 }
@@ -580,8 +821,8 @@ const_dlist_iterator<T_>::~const_dlist_iterator(){
 *		@return:	const_dlist_iterator& newly assigned object
 *		@pre:		None
 *		@post:		this contains the private members of lhs*/
-template<typename T_>
-typename const_dlist_iterator<T_>& const_dlist_iterator<T_>::operator=(typename const_dlist_iterator<T_> const& lhs){
+template<typename T_, typename Allocator_>
+typename const_dlist_iterator<T_, Allocator_>& const_dlist_iterator<T_, Allocator_>::operator=(typename const_dlist_iterator<T_, Allocator_> const& lhs){
 	this->dlist_ = lhs.dlist_;
 	this->node_ = lhs.node_;
 	return *this;
@@ -592,8 +833,8 @@ typename const_dlist_iterator<T_>& const_dlist_iterator<T_>::operator=(typename
 *		@return:	const_dlist_iterator<T_> of the incremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is incremented*/
-template<typename T_>
-typename const_dlist_iterator<T_>& const_dlist_iterator<T_>::operator++(){
+template<typename T_, typename Allocator_>
+typename const_dlist_iterator<T_, Allocator_>& const_dlist_iterator<T_, Allocator_>::operator++(){
 	assert(!(node_ == dlist_->head_));
 	node_ = node_->next_;
 	return *this;
@@ -604,9 +845,9 @@ typename const_dlist_iterator<T_>& const_dlist_iterator<T_>::operator++(){
 *		@return:	const_dlist_iterator<T_> of the incremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is incremented*/
-template<typename T_>
-typename const_dlist_iterator<T_> const_dlist_iterator<T_>::operator++(int){
-	const_dlist_iterator<T_> temp = *this;
+template<typename T_, typename Allocator_>
+typename const_dlist_iterator<T_, Allocator_> const_dlist_iterator<T_, Allocator_>::operator++(int){
+	const_dlist_iterator<T_, Allocator_> temp = *this;
 	++*this;
 	return (temp);
 }
@@ -616,8 +857,8 @@ typename const_dlist_iterator<T_> const_dlist_iterator<T_>::operator++(int){
 *		@return:	const_dlist_iterator<T_> of the decremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is decremented*/
-template<typename T_>
-typename  const_dlist_iterator<T_>& const_dlist_iterator<T_>::operator--(){
+template<typename T_, typename Allocator_>
+typename  const_dlist_iterator<T_, Allocator_>& const_dlist_iterator<T_, Allocator_>::operator--(){
 	assert(!(node_ == dlist_->head_->next_));
 	node_ = node_->prev_;
 	return *this;
@@ -628,9 +869,9 @@ typename  const_dlist_iterator<T_>& const_dlist_iterator<T_>::operator--(){
 *		@return:	const_dlist_iterator<T_> of the decremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is decremented*/
-template<typename T_>
-typename const_dlist_iterator<T_> const_dlist_iterator<T_>::operator--(int){
-	const_dlist_iterator<T_> temp = *this;
+template<typename T_, typename Allocator_>
+typename const_dlist_iterator<T_, Allocator_> const_dlist_iterator<T_, Allocator_>::operator--(int){
+	const_dlist_iterator<T_, Allocator_> temp = *this;
 	--*this;
 	return (temp);
 }
@@ -640,8 +881,8 @@ typename const_dlist_iterator<T_> const_dlist_iterator<T_>::operator--(int){
 *		@return:	a constant reference to the value type
 *		@pre:		Parameter object must have been constructed 
 *		@post:		Returns a constant reference to the value typee*/
-template<typename T_>
-typename const const_dlist_iterator<T_>::reference const_dlist_iterator<T_>::operator*() const{
+template<typename T_, typename Allocator_>
+typename const const_dlist_iterator<T_, Allocator_>::reference const_dlist_iterator<T_, Allocator_>::operator*() const{
 	assert(!(node_ == dlist_->head_));
 	return node_->elem_;
 }
@@ -651,8 +892,8 @@ typename const const_dlist_iterator<T_>::reference const_dlist_iterator<T_>::ope
 *		@return:	bool indicating if they are the same
 *		@pre:		Parameter object must have been constructed
 *		@post:		client receives bool indicating if they are the same*/
-template<typename T_>
-bool const_dlist_iterator<T_>::operator==(typename const_dlist_iterator<T_> const& lhs) const{
+template<typename T_, typename Allocator_>
+bool const_dlist_iterator<T_, Allocator_>::operator==(typename const_dlist_iterator<T_, Allocator_> const& lhs) const{
 	return this->node_->elem_ == lhs.node_->elem_ && this->node_ == lhs.node_ &&  this->dlist_ == lhs.dlist_ ;
 }
 /*		@fn:		bool operator!=(const_dlist_iterator<T_> const& rhs) const
@@ -661,8 +902,8 @@ bool const_dlist_iterator<T_>::operator==(typename const_dlist_iterator<T_> cons
 *		@return:	bool indicating if they are different
 *		@pre:		Parameter object must have been constructed
 *		@post:		client receives bool indicating if they are different*/
-template<typename T_>
-bool const_dlist_iterator<T_>::operator!=(typename const_dlist_iterator<T_> const& lhs) const{
+template<typename T_, typename Allocator_>
+bool const_dlist_iterator<T_, Allocator_>::operator!=(typename const_dlist_iterator<T_, Allocator_> const& lhs) const{
 	return !(*this == lhs);
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+#if !defined(GUARD_NODE_POOL_HPP)
+#define GUARD_NODE_POOL_HPP
+
+/** @file: node_pool.hpp
+@author Robbie Brandrick
+@author r_brandrick@fanshaweonline.ca
+@date 2012-02-24
+@version 0.1.0
+@note Targets Visual C++ 10.0
+@briefs Slab pool for list nodes.
+		node_pool class declaration and implementation.
+		pool_allocator class declaration and implementation, an allocator drawing nodes and node arrays from a node_pool
+		Copies of a squarelist share their nodes and so their pool, and whichever thread drops the last
+		copy of a node frees it, so the pool locks around every change to its free lists
+@invariant every block handed out by a node_pool lives in one of its slabs or was too large to pool*/
+
+#include <cstddef>
+#include <new>
+#include <memory>
+#include <type_traits>
+#include <mutex>
+
+class node_pool{
+public:
+	typedef std::size_t size_type;
+
+	explicit node_pool(size_type firstSlab = 32);
+	~node_pool();
+
+	void* allocate(size_type bytes);
+	void deallocate(void* block, size_type bytes);
+	void release();
+
+	size_type live() const;
+	size_type slabs() const;
+private:
+	node_pool(node_pool const&);
+	node_pool& operator=(node_pool const&);
+
+	//small blocks are rounded up to the granularity, larger ones up to a power of two,
+	//larger blocks than the last class are not pooled
+	enum { granularity = 2 * sizeof(void*) < 16 ? 16 : 2 * sizeof(void*), classes = 16, largeClasses = 12 };
+	struct free_block{ free_block* next_; };
+	struct slab{ slab* next_; };
+
+	mutable std::mutex	mutex_;
+	free_block* free_[classes + largeClasses];
+	size_type	nextSlab_[classes];
+	slab*		slab_;
+	size_type	slabs_;
+	size_type	live_;
+
+	static size_type sizeClass(size_type bytes);
+	static size_type blockSize(size_type sizeClass);
+	void grow(size_type sizeClass);
+};
+/*		@fn:	    node_pool(size_type firstSlab);
+*		@brief:		constructor
+*		@pram:		size_type firstSlab [in] number of blocks in the first slab of each block size.
+*		@return:	none.
+*		@pre:		firstSlab must not be zero.
+*		@post:		An empty pool is constructed, no slab is allocated until a block is asked for.*/
+inline node_pool::node_pool(size_type firstSlab) : slab_(nullptr), slabs_(0), live_(0){
+	for(size_type index = 0; index < classes + largeClasses; ++index)
+		free_[index] = nullptr;
+	for(size_type index = 0; index < classes; ++index)
+		nextSlab_[index] = firstSlab;
+}
+/*		@fn:	    ~node_pool();
+*		@brief:		destructor
+*		@pram:		none.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		Every slab is given back in bulk, blocks still handed out become invalid.*/
+inline node_pool::~node_pool(){
+	release();
+}
+/*		@fn:		void* allocate(size_type bytes)
+*		@brief:		Hands out a block of at least bytes
+*		@pram:		size_type bytes [in] size of the block wanted.
+*		@return:	void* the block, aligned for any type no larger than the pool granularity.
+*		@pre:		none.
+*		@post:		The block is popped off its size's free list, a slab is carved when that list is empty*/
+inline void* node_pool::allocate(size_type bytes){
+	size_type index = sizeClass(bytes ? bytes : 1);
+	if(index >= classes + largeClasses)
+		return ::operator new(bytes);
+	std::lock_guard<std::mutex> lock(mutex_);
+	if(free_[index] == nullptr)
+		grow(index);
+	free_block* block = free_[index];
+	free_[index] = block->next_;
+	++live_;
+	return block;
+}
+/*		@fn:		void deallocate(void* block, size_type bytes)
+*		@brief:		Takes back a block handed out by allocate
+*		@pram:		void* block [in] block to be taken back.
+*					size_type bytes [in] size the block was asked for with.
+*		@return:	void.
+*		@pre:		block must have come from this pool with the same size.
+*		@post:		The block is pushed on its size's free list, no memory is given back to the system*/
+inline void node_pool::deallocate(void* block, size_type bytes){
+	size_type index = sizeClass(bytes ? bytes : 1);
+	if(index >= classes + largeClasses){
+		::operator delete(block);
+		return;
+	}
+	std::lock_guard<std::mutex> lock(mutex_);
+	free_block* freed = static_cast<free_block*>(block);
+	freed->next_ = free_[index];
+	free_[index] = freed;
+	--live_;
+}
+/*		@fn:		void release()
+*		@brief:		Gives every slab back to the system at once
+*		@pram:		none.
+*		@return:	void.
+*		@pre:		No pooled block may still be in use.
+*		@post:		The pool is empty, the next allocate carves a new slab*/
+inline void node_pool::release(){
+	std::lock_guard<std::mutex> lock(mutex_);
+	while(slab_ != nullptr){
+		slab* next = slab_->next_;
+		::operator delete(slab_);
+		slab_ = next;
+	}
+	for(size_type index = 0; index < classes + largeClasses; ++index)
+		free_[index] = nullptr;
+	slabs_ = 0;
+	live_ = 0;
+}
+/*		@fn:		size_type live() const
+*		@brief:		Counts the pooled blocks handed out and not yet taken back
+*		@pram:		none.
+*		@return:	size_type number of live blocks.
+*		@pre:		none.
+*		@post:		none.*/
+inline node_pool::size_type node_pool::live() const{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return live_;
+}
+/*		@fn:		size_type slabs() const
+*		@brief:		Counts the slabs taken from the system
+*		@pram:		none.
+*		@return:	size_type number of slabs.
+*		@pre:		none.
+*		@post:		none.*/
+inline node_pool::size_type node_pool::slabs() const{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return slabs_;
+}
+/*		@fn:		static size_type sizeClass(size_type bytes)
+*		@brief:		Finds the free list a block size is served from
+*		@pram:		size_type bytes [in] size of the block wanted, not zero.
+*		@return:	size_type index of the size class, past the last class when the block is not pooled.
+*		@pre:		none.
+*		@post:		Small sizes step by the granularity, sizes past them double*/
+inline node_pool::size_type node_pool::sizeClass(size_type bytes){
+	if(bytes <= classes * granularity)
+		return (bytes + granularity - 1) / granularity - 1;
+	size_type index = classes;
+	for(size_type size = 2 * classes * granularity; size < bytes && index < classes + largeClasses; size *= 2)
+		++index;
+	return index;
+}
+/*		@fn:		static size_type blockSize(size_type sizeClass)
+*		@brief:		Gets the size of the blocks of a size class
+*		@pram:		size_type sizeClass [in] index of a pooled size class.
+*		@return:	size_type size of its blocks in bytes.
+*		@pre:		sizeClass must be a pooled size class.
+*		@post:		none.*/
+inline node_pool::size_type node_pool::blockSize(size_type sizeClass){
+	if(sizeClass < classes)
+		return (sizeClass + 1) * granularity;
+	return (classes * granularity) << (sizeClass - classes + 1);
+}
+/*		@fn:		void grow(size_type sizeClass)
+*		@brief:		Carves a new slab into free blocks of one size
+*		@pram:		size_type sizeClass [in] size class whose free list is empty.
+*		@return:	void.
+*		@pre:		The caller holds mutex_.
+*		@post:		The free list holds the new blocks, the next slab of a small size is twice as large
+*					so the number of slabs grows with the log of the nodes in use. A large block, such as
+*					a node array, gets a slab of its own and is kept for the next array of its size*/
+inline void node_pool::grow(size_type sizeClass){
+	size_type size = blockSize(sizeClass);
+	size_type count = sizeClass < classes ? nextSlab_[sizeClass] : 1;
+	char* memory = static_cast<char*>(::operator new(granularity + count * size));
+	slab* carved = reinterpret_cast<slab*>(memory);
+	carved->next_ = slab_;
+	slab_ = carved;
+	++slabs_;
+	if(sizeClass < classes)
+		nextSlab_[sizeClass] = count * 2;
+
+	char* block = memory + granularity;
+	for(size_type index = 0; index < count; ++index, block += size){
+		free_block* freed = reinterpret_cast<free_block*>(block);
+		freed->next_ = free_[sizeClass];
+		free_[sizeClass] = freed;
+	}
+}
+
+template<typename T_>
+class pool_allocator{
+	template<typename U_> friend class pool_allocator;
+public:
+	typedef T_					value_type;
+	typedef T_*					pointer;
+	typedef T_ const*			const_pointer;
+	typedef std::size_t			size_type;
+	typedef std::ptrdiff_t		difference_type;
+	typedef std::true_type		propagate_on_container_copy_assignment;
+	typedef std::true_type		propagate_on_container_move_assignment;
+	typedef std::true_type		propagate_on_container_swap;
+
+	pool_allocator() : pool_(std::make_shared<node_pool>()){}
+	explicit pool_allocator(std::shared_ptr<node_pool> const& pool) : pool_(pool){}
+	template<typename U_>
+	pool_allocator(pool_allocator<U_> const& rhs) : pool_(rhs.pool_){}
+
+	T_* allocate(size_type count);
+	void deallocate(T_* block, size_type count);
+
+	std::shared_ptr<node_pool> const& pool() const{return pool_;}
+
+	template<typename U_>
+	bool operator==(pool_allocator<U_> const& rhs) const{return pool_ == rhs.pool_;}
+	template<typename U_>
+	bool operator!=(pool_allocator<U_> const& rhs) const{return pool_ != rhs.pool_;}
+private:
+	std::shared_ptr<node_pool> pool_;
+};
+/*		@fn:		T_* allocate(size_type count)
+*		@brief:		Allocates room for count objects
+*		@pram:		size_type count [in] number of objects.
+*		@return:	T_* uninitialized storage.
+*		@pre:		none.
+*		@post:		List nodes and node arrays come from the pool, blocks too large to pool go to ::operator new.
+*					Over aligned types skip the pool and come from the aligned ::operator new, so their
+*					storage is aligned to alignof(T_)*/
+template<typename T_>
+T_* pool_allocator<T_>::allocate(size_type count){
+	if(alignof(T_) <= alignof(std::max_align_t))
+		return static_cast<T_*>(pool_->allocate(count * sizeof(T_)));
+	return static_cast<T_*>(::operator new(count * sizeof(T_), std::align_val_t(alignof(T_))));
+}
+/*		@fn:		void deallocate(T_* block, size_type count)
+*		@brief:		Gives back storage from allocate
+*		@pram:		T_* block [in] storage to give back.
+*					size_type count [in] number of objects it was allocated for.
+*		@return:	void.
+*		@pre:		block must have come from an allocator sharing this pool.
+*		@post:		Pooled storage goes back on the pool's free list*/
+template<typename T_>
+void pool_allocator<T_>::deallocate(T_* block, size_type count){
+	if(alignof(T_) <= alignof(std::max_align_t))
+		pool_->deallocate(block, count * sizeof(T_));
+	else
+		::operator delete(block, std::align_val_t(alignof(T_)));
+}
+#endif
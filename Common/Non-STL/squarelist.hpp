@@ -10,22 +10,43 @@
 @briefs squarelist class definition and implementation.
 		squarelist iterator definition and implementation
 		squarelist constant iterator definition and implementation
+		By default every vertical list draws its nodes from one node_pool shared by the square list,
+		compact_dlist columns keep each vertical list in one array of index linked nodes and
+		unrolled_dlist columns pack a cache line of values into every node
 @invariant  squarelist will always be square and sorted
 */
 #include "dlist.hpp"
+#include "node_pool.hpp"
+#include "compact_dlist.hpp"
+#include "unrolled_dlist.hpp"
+#include <vector>
 #include <memory>
+#include <atomic>
 #include <algorithm>
+#include <utility>
+#include <functional>
 #include <cassert>
 
+/*Gives a vertical list type the square list's allocator, so compact_dlist<T_> with a pool_allocator
+  square list is a compact_dlist<T_, pool_allocator<T_>> drawing its node array from the pool*/
+template<typename Column_, typename Allocator_>
+struct rebind_column{
+		typedef Column_ type;
+};
+template<template<typename, typename> class List_, typename T_, typename A_, typename Allocator_>
+struct rebind_column<List_<T_, A_>, Allocator_>{
+		typedef List_<T_, Allocator_> type;
+};
+
 //forward declare iterators
-template<typename T_> class squarelist_iterator;
-template<typename T_> class const_squarelist_iterator;
+template<typename T_, typename Compare_ = std::less<T_>, typename Allocator_ = pool_allocator<T_>, typename Column_ = dlist<T_, Allocator_>> class squarelist_iterator;
+template<typename T_, typename Compare_ = std::less<T_>, typename Allocator_ = pool_allocator<T_>, typename Column_ = dlist<T_, Allocator_>> class const_squarelist_iterator;
 
 /*squarelist class definition*/
-template<typename T_>
+template<typename T_, typename Compare_ = std::less<T_>, typename Allocator_ = pool_allocator<T_>, typename Column_ = dlist<T_, Allocator_>>
 class squarelist{
-		friend class squarelist_iterator<T_>;
-		friend class const_squarelist_iterator<T_>;
+		friend class squarelist_iterator<T_, Compare_, Allocator_, Column_>;
+		friend class const_squarelist_iterator<T_, Compare_, Allocator_, Column_>;
 public:
 		typedef std::size_t					size_type;
 		typedef std::ptrdiff_t				difference_type;
@@ -35,28 +56,41 @@ public:
 		typedef T_ *						pointer;
 		typedef	T_ const *					const_pointer;
 
-		typedef squarelist_iterator<T_>			iterator;
-		typedef	const_squarelist_iterator<T_> 	const_iterator;
+		typedef squarelist_iterator<T_, Compare_, Allocator_, Column_>			iterator;
+		typedef	const_squarelist_iterator<T_, Compare_, Allocator_, Column_> 	const_iterator;
 		typedef	std::ptrdiff_t	difference_type;
 
 		typedef	std::reverse_iterator<iterator>			reverse_iterator;
 		typedef	std::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+		typedef Compare_					key_compare;
+		typedef Allocator_					allocator_type;
 private:
-		typedef dlist<T_>				list;
+		typedef typename rebind_column<Column_, Allocator_>::type	list;
 		typedef std::shared_ptr<list>		inner_list;
-		typedef dlist<inner_list>	    outter_list;
+		typedef typename std::allocator_traits<Allocator_>::template rebind_alloc<inner_list>	outter_allocator;
+		typedef dlist<inner_list, outter_allocator>	    outter_list;
 		typedef std::shared_ptr<outter_list>		squarelist_container;
+		typedef typename std::allocator_traits<Allocator_>::template rebind_alloc<typename outter_list::iterator>	directory_allocator;
+		typedef std::vector<typename outter_list::iterator, directory_allocator>	column_directory;
 private:
+		Compare_					comp_;
+		Allocator_					alloc_;
 		squarelist_container		squarelist_;
+		column_directory			directory_;
 		size_type					size_;
+		size_type					shifts_;
 public:
 		squarelist();
-		squarelist( squarelist<value_type> const& slist );
-		squarelist( squarelist<value_type> && slist );
+		explicit squarelist( Compare_ const& comp, Allocator_ const& alloc = Allocator_() );
+		squarelist( squarelist<T_, Compare_, Allocator_, Column_> const& slist );
+		squarelist( squarelist<T_, Compare_, Allocator_, Column_> && slist );
+		template<typename ForwardIterator>
+		squarelist( ForwardIterator first, ForwardIterator last, Compare_ const& comp = Compare_(), Allocator_ const& alloc = Allocator_() );
 		~squarelist(){}
 
-		squarelist<value_type>& operator=(squarelist<value_type> const& rhs);
-		squarelist<value_type>& operator=(squarelist<value_type> && rhs);
+		squarelist<T_, Compare_, Allocator_, Column_>& operator=(squarelist<T_, Compare_, Allocator_, Column_> const& rhs);
+		squarelist<T_, Compare_, Allocator_, Column_>& operator=(squarelist<T_, Compare_, Allocator_, Column_> && rhs);
 
 		iterator begin();
 		const_iterator begin() const;
@@ -74,6 +108,8 @@ public:
 		const_reverse_iterator rend() const;
 		const_reverse_iterator crend() const;
 		void clear();
+		template<typename ForwardIterator>
+		void assign(ForwardIterator first, ForwardIterator last);
 		bool empty();
 
 		const_reference front() const;
@@ -81,19 +117,79 @@ public:
 		const_reference back() const;
 
 		iterator erase(iterator position);
+		iterator erase(iterator first, iterator last);
+		size_type erase_range(const_reference lo, const_reference hi);
 		bool erase (const_reference x );
 		void insert (const_reference x );
+		void insert (value_type&& x );
+		template<typename... Args>
+		void emplace(Args&&... args);
+		template<typename InputIterator>
+		void insert(InputIterator first, InputIterator last);
+		void merge(squarelist<T_, Compare_, Allocator_, Column_> && other);
+		void merge(squarelist<T_, Compare_, Allocator_, Column_> const& other);
+		squarelist<T_, Compare_, Allocator_, Column_> split(const_reference key);
+		void join(squarelist<T_, Compare_, Allocator_, Column_> && other);
+		squarelist<T_, Compare_, Allocator_, Column_> inserted(const_reference x) const;
+		squarelist<T_, Compare_, Allocator_, Column_> erased(const_reference x) const;
+
+		iterator find(const_reference x);
+		const_iterator find(const_reference x) const;
+		bool contains(const_reference x) const;
+		size_type count(const_reference x) const;
+		iterator lower_bound(const_reference x);
+		const_iterator lower_bound(const_reference x) const;
+		iterator upper_bound(const_reference x);
+		const_iterator upper_bound(const_reference x) const;
+		std::pair<iterator, iterator> equal_range(const_reference x);
+		std::pair<const_iterator, const_iterator> equal_range(const_reference x) const;
+
+		iterator nth(size_type index);
+		const_iterator nth(size_type index) const;
+		const_reference operator[](size_type index) const;
+		size_type rank(const_reference x) const;
+		size_type index_of(const_iterator x) const;
 
 		size_type size() const;
+		size_type shifts() const;
+		key_compare key_comp() const;
+		allocator_type get_allocator() const;
 
 		void print(std::string fileName);
 private:
-		void putInVertList(const_reference x);
+		inner_list newVertList() const;
+		squarelist_container newContainer() const;
+		size_type maxDepth() const;
+		size_type findVertList(const_reference x) const;
+		size_type lowerVertList(const_reference x) const;
+		size_type upperVertList(const_reference x) const;
+		template<typename U_>
+		size_type putInVertList(U_&& x);
+		template<typename U_>
+		void insertValue(U_&& x);
 		bool eraseInVertList(const_reference x);
 		iterator eraseInVertList(iterator x);
 		void balance();
-		void shiftLeft(typename outter_list::iterator iter);
-		void shiftRight(typename outter_list::iterator iter);
+		void balance(size_type col);
+		void shiftLeft(size_type col);
+		void shiftRight(size_type col);
+		void splitVertList(size_type col);
+		typename outter_list::iterator appendVertList();
+		void rebuildDirectory();
+		template<typename P_>
+		static bool unshared(std::shared_ptr<P_> const& shared);
+		void detach();
+		list& ownVertList(typename outter_list::iterator column);
+		iterator ownPosition(iterator x);
+		void squareUp();
+		void skipEmptyVertLists(outter_list& source, typename outter_list::iterator& col, typename list::iterator& pos);
+		void takeValue(list& column, outter_list& source, typename outter_list::iterator& col, typename list::iterator& pos, bool move);
+		template<typename A_>
+		static void relinkValue(dlist<T_, A_>& column, dlist<T_, A_>& source, typename dlist<T_, A_>::iterator pos);
+		template<typename List_>
+		static void relinkValue(List_& column, List_& source, typename List_::iterator pos);
+		void layOut();
+		void mergeLayOut(squarelist_container rhs, size_type count, bool moveRhs);
 #if defined(_DEBUG)
 		bool is_square();
 		bool is_sorted();
@@ -107,20 +203,37 @@ private:
 *		@pre:		none.
 *		@post:		a squarelist object is created.
 */
-template<typename T_>
-inline squarelist<T_>::squarelist() 
-	: squarelist_(squarelist_container( new outter_list())), size_(0){
-		this->squarelist_->push_back(inner_list(new list()));
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+inline squarelist<T_, Compare_, Allocator_, Column_>::squarelist() 
+	: comp_(), alloc_(), squarelist_(newContainer()), directory_(directory_allocator(alloc_)), size_(0), shifts_(0){
+		this->squarelist_->push_back(newVertList());
+		this->directory_.push_back(this->squarelist_->begin());
 }
-/*		@fn:		squarelist() 
+/*		@fn:		squarelist( Compare_ const& comp, Allocator_ const& alloc ) 
+*		@brief:		Constructor taking the ordering and the allocator
+*		@pram:		Compare_ const& comp [in] strict weak ordering the values are kept in
+*					Allocator_ const& alloc [in] allocator every list of the container is built from
+*		@return:	nothing
+*		@pre:		none.
+*		@post:		an empty squarelist object is created.
+*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+inline squarelist<T_, Compare_, Allocator_, Column_>::squarelist( Compare_ const& comp, Allocator_ const& alloc ) 
+	: comp_(comp), alloc_(alloc), squarelist_(newContainer()), directory_(directory_allocator(alloc_)), size_(0), shifts_(0){
+		this->squarelist_->push_back(newVertList());
+		this->directory_.push_back(this->squarelist_->begin());
+}
+/*		@fn:		squarelist( squarelist<value_type> const& slist ) 
 *		@brief:		Copy Constructor
-*		@pram:		None.
+*		@pram:		squarelist<value_type> const& slist [in] squarelist to copy
 *		@return:	nothing
 *		@pre:		none.
-*		@post:		a squarelist object is created.
+*		@post:		a squarelist object is created sharing the outer list and vertical lists of SLIST.
+*						No value is copied, whichever copy writes first clones the outer list and
+*						only the vertical lists it touches
 */
-template<typename T_>
-inline squarelist<T_>::squarelist(squarelist<T_> const& slist) : squarelist_( slist.squarelist_ ),size_(slist.size_){}
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+inline squarelist<T_, Compare_, Allocator_, Column_>::squarelist(squarelist<T_, Compare_, Allocator_, Column_> const& slist) : comp_( slist.comp_ ), alloc_( slist.alloc_ ), squarelist_( slist.squarelist_ ), directory_( slist.directory_ ), size_(slist.size_), shifts_(slist.shifts_){}
 
 /*		@fn:		squarelist( squarelist<value_type> && slist ) 
 *		@brief:		Move Constructor
@@ -129,13 +242,31 @@ inline squarelist<T_>::squarelist(squarelist<T_> const& slist) : squarelist_( sl
 *		@pre:		none.
 *		@post:		Value is copied.
 */
-template<typename T_>
-inline squarelist<T_>::squarelist( squarelist<value_type> && slist ) 
-		:	squarelist_(std::move(slist.squarelist_))
-		,	size_(std::move(slist.size_)){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+inline squarelist<T_, Compare_, Allocator_, Column_>::squarelist( squarelist<T_, Compare_, Allocator_, Column_> && slist ) 
+		:	comp_(slist.comp_)
+		,	alloc_(slist.alloc_)
+		,	squarelist_(std::move(slist.squarelist_))
+		,	directory_(std::move(slist.directory_))
+		,	size_(std::move(slist.size_))
+		,	shifts_(slist.shifts_){
 				slist.squarelist_ = nullptr;
 				slist.size_ = 0;
 }
+/*		@fn:		squarelist( ForwardIterator first, ForwardIterator last ) 
+*		@brief:		Range Constructor, bulk loads a sorted range
+*		@pram:		ForwardIterator first [in] first value of the range
+*					ForwardIterator last [in] one past the last value of the range
+*		@return:	nothing
+*		@pre:		the range must be sorted.
+*		@post:		a squarelist object is created holding the range in full vertical lists.
+*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template<typename ForwardIterator>
+inline squarelist<T_, Compare_, Allocator_, Column_>::squarelist( ForwardIterator first, ForwardIterator last, Compare_ const& comp, Allocator_ const& alloc ) 
+	: comp_(comp), alloc_(alloc), directory_(directory_allocator(alloc_)), size_(0), shifts_(0){
+		this->assign(first, last);
+}
 /*		@fn:		iterator begin()
 *		@brief:		return the beginning of the aggregate to the iterator
 *		@pram:		None
@@ -143,8 +274,8 @@ inline squarelist<T_>::squarelist( squarelist<value_type> && slist )
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::iterator squarelist<T_>::begin(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::begin(){
 	return iterator(
 		squarelist_->size() == 1 && squarelist_->front()->size() == 0 ? this->squarelist_->end() : this->squarelist_->begin(),
 		this->squarelist_->end()
@@ -157,8 +288,8 @@ typename squarelist<T_>::iterator squarelist<T_>::begin(){
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::const_iterator squarelist<T_>::begin() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator squarelist<T_, Compare_, Allocator_, Column_>::begin() const{
 	return const_iterator(
 		squarelist_->size() == 1 && squarelist_->front()->size() == 0 ? this->squarelist_->cend() : this->squarelist_->cbegin(),
 		this->squarelist_->cend()
@@ -171,8 +302,8 @@ typename squarelist<T_>::const_iterator squarelist<T_>::begin() const{
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::const_iterator squarelist<T_>::cbegin() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator squarelist<T_, Compare_, Allocator_, Column_>::cbegin() const{
 	return const_iterator(
 		squarelist_->size() == 1 && squarelist_->front()->size() == 0 ? this->squarelist_->cend() : this->squarelist_->cbegin(),
 		this->squarelist_->cend()
@@ -185,8 +316,8 @@ typename squarelist<T_>::const_iterator squarelist<T_>::cbegin() const{
 *		@pre:		none.
 *		@post:		reverse_iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::reverse_iterator squarelist<T_>::rbegin(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::reverse_iterator squarelist<T_, Compare_, Allocator_, Column_>::rbegin(){
 	return  reverse_iterator(end());
 }
 /*		@fn:		const_reverse_iterator rbegin() const
@@ -196,8 +327,8 @@ typename squarelist<T_>::reverse_iterator squarelist<T_>::rbegin(){
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::const_reverse_iterator squarelist<T_>::rbegin() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_reverse_iterator squarelist<T_, Compare_, Allocator_, Column_>::rbegin() const{
 	return  const_reverse_iterator(cend());
 }
 /*		@fn:		const_reverse_iterator crbegin() const
@@ -207,8 +338,8 @@ typename squarelist<T_>::const_reverse_iterator squarelist<T_>::rbegin() const{
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::const_reverse_iterator squarelist<T_>::crbegin() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_reverse_iterator squarelist<T_, Compare_, Allocator_, Column_>::crbegin() const{
 	return  const_reverse_iterator(cend());
 }
 /*		@fn:		iterator end()
@@ -218,8 +349,8 @@ typename squarelist<T_>::const_reverse_iterator squarelist<T_>::crbegin() const{
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::iterator squarelist<T_>::end(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::end(){
 	return iterator(
 		this->squarelist_->end(),
 		this->squarelist_->end()
@@ -232,8 +363,8 @@ typename squarelist<T_>::iterator squarelist<T_>::end(){
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::const_iterator squarelist<T_>::end() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator squarelist<T_, Compare_, Allocator_, Column_>::end() const{
 	return const_iterator(
 		this->squarelist_->cend(),
 		this->squarelist_->cend()
@@ -246,8 +377,8 @@ typename squarelist<T_>::const_iterator squarelist<T_>::end() const{
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::const_iterator squarelist<T_>::cend() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator squarelist<T_, Compare_, Allocator_, Column_>::cend() const{
 	return const_iterator(
 		this->squarelist_->cend(),
 		this->squarelist_->cend()
@@ -260,8 +391,8 @@ typename squarelist<T_>::const_iterator squarelist<T_>::cend() const{
 *		@pre:		none.
 *		@post:		reverse_iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::reverse_iterator squarelist<T_>::rend(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::reverse_iterator squarelist<T_, Compare_, Allocator_, Column_>::rend(){
 	return  reverse_iterator(begin());
 }
 /*		@fn:		const_reverse_iterator rend() const
@@ -271,8 +402,8 @@ typename squarelist<T_>::reverse_iterator squarelist<T_>::rend(){
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::const_reverse_iterator squarelist<T_>::rend() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_reverse_iterator squarelist<T_, Compare_, Allocator_, Column_>::rend() const{
 	return  const_reverse_iterator(cbegin());
 }
 /*		@fn:		const_reverse_iterator crend() const
@@ -282,8 +413,8 @@ typename squarelist<T_>::const_reverse_iterator squarelist<T_>::rend() const{
 *		@pre:		none.
 *		@post:		Iterator is returned to the client.
 */
-template<typename T_>
-typename squarelist<T_>::const_reverse_iterator squarelist<T_>::crend() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_reverse_iterator squarelist<T_, Compare_, Allocator_, Column_>::crend() const{
 	return  const_reverse_iterator(cbegin());
 }
 /*		@fn:        const_reference front();
@@ -292,8 +423,8 @@ typename squarelist<T_>::const_reverse_iterator squarelist<T_>::crend() const{
 *		@return:	const_reference to the first element in the square list
 *		@pre:		there must be at least one element in the square list
 *		@post:		a const_reference to the first element will be returned. */
-template<typename T_>
-typename squarelist<T_>::const_reference squarelist<T_>::front() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference squarelist<T_, Compare_, Allocator_, Column_>::front() const{
 	assert(!(size_ == 0));	
 	return this->squarelist_->front()->front();
 }
@@ -303,8 +434,8 @@ typename squarelist<T_>::const_reference squarelist<T_>::front() const{
 *		@return:	const_reference to the last element in the square list
 *		@pre:		there must be at least one element in the square list
 *		@post:		a const_reference to the last element will be returned. */
-template<typename T_>	
-typename squarelist<T_>::const_reference squarelist<T_>::back() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference squarelist<T_, Compare_, Allocator_, Column_>::back() const{
 		assert(!(size_ == 0));	
 		return this->squarelist_->back()->back();
 }
@@ -314,22 +445,99 @@ typename squarelist<T_>::const_reference squarelist<T_>::back() const{
 *		@return:	a size_type of the square list size
 *		@pre:		none.
 *		@post:		a value type of the squarelist size will be returned. */
-template<typename T_>	
-typename squarelist<T_>::size_type squarelist<T_>::size() const{ 
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::size() const{ 
 		return size_; 
 }
+/*		@fn:        size_type shifts();
+*		@brief:		Get the number of values moved between vertical lists by balancing
+*		@pram:		none.
+*		@return:	a size_type of the values moved since the square list was created
+*		@pre:		none.
+*		@post:		the running total of balancing moves will be returned. */
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::shifts() const{ 
+		return shifts_; 
+}
+/*		@fn:        key_compare key_comp() const;
+*		@brief:		Gets the ordering the values are kept in
+*		@pram:		None.
+*		@return:	key_compare a copy of the comparison object
+*		@pre:		None.
+*		@post:		None.*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::key_compare squarelist<T_, Compare_, Allocator_, Column_>::key_comp() const{ 
+		return comp_; 
+}
+/*		@fn:        allocator_type get_allocator() const;
+*		@brief:		Gets the allocator the lists are built from
+*		@pram:		None.
+*		@return:	allocator_type a copy of the allocator
+*		@pre:		None.
+*		@post:		None.*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::allocator_type squarelist<T_, Compare_, Allocator_, Column_>::get_allocator() const{ 
+		return alloc_; 
+}
+/*		@fn:        inner_list newVertList() const;
+*		@brief:		Creates an empty vertical list, the list and its control block come from the allocator
+*		@pram:		None.
+*		@return:	inner_list the new vertical list
+*		@pre:		None.
+*		@post:		None.*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::inner_list squarelist<T_, Compare_, Allocator_, Column_>::newVertList() const{ 
+		return std::allocate_shared<list>(alloc_, alloc_); 
+}
+/*		@fn:        squarelist_container newContainer() const;
+*		@brief:		Creates an empty horizontal list, the list and its control block come from the allocator
+*		@pram:		None.
+*		@return:	squarelist_container the new horizontal list
+*		@pre:		None.
+*		@post:		None.*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::squarelist_container squarelist<T_, Compare_, Allocator_, Column_>::newContainer() const{ 
+		return std::allocate_shared<outter_list>(alloc_, outter_allocator(alloc_)); 
+}
 /*		@fn:        void clear();
 *		@brief:		clears all the elements in the squarelist
 *		@pram:		none.
 *		@return:	nothing.
 *		@pre:		None.
-*		@post:		The squarelist container will not contain elements*/
-template<typename T_>
-typename void squarelist<T_>::clear() { 
-		this->squarelist_->clear(); 
+*		@post:		The squarelist container will not contain elements, copies sharing its storage keep theirs*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename void squarelist<T_, Compare_, Allocator_, Column_>::clear() { 
 		this->size_ = 0;
-		squarelist_ = squarelist_container( new outter_list());
-		this->squarelist_->push_back(inner_list(new list()));
+		squarelist_ = newContainer();
+		this->squarelist_->push_back(newVertList());
+		this->directory_.assign(1, this->squarelist_->begin());
+}
+/*		@fn:        void assign(ForwardIterator first, ForwardIterator last);
+*		@brief:		Replaces the elements in the squarelist with a sorted range
+*		@pram:		ForwardIterator first [in] first value of the range
+*					ForwardIterator last [in] one past the last value of the range
+*		@return:	nothing.
+*		@pre:		the range must be sorted.
+*		@post:		The squarelist holds the range, every vertical list but the last is filled to the max depth.
+*						The range is laid out in one pass without balancing*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template<typename ForwardIterator>
+void squarelist<T_, Compare_, Allocator_, Column_>::assign(ForwardIterator first, ForwardIterator last){
+		this->size_ = std::distance(first, last);
+		size_type depth = this->maxDepth();
+		//the old vertical lists are kept alive in case the range is read from them
+		squarelist_container old = this->squarelist_;
+		squarelist_ = newContainer();
+		this->directory_.clear();
+		do{
+				typename outter_list::iterator column = appendVertList();
+				for(size_type count = 0; count < depth && first != last; ++count, ++first)
+						(*column)->push_back(*first);
+		}while(first != last);
+	#if defined (_DEBUG)
+			assert(is_sorted());
+			assert(is_square());
+	#endif
 }
 /*		@fn:        void empty();
 *		@brief:		Checks if the squarelist contains any elements
@@ -337,8 +545,8 @@ typename void squarelist<T_>::clear() {
 *		@return:		bool indicating if the square list container is empty or not.
 *		@pre:		None.
 *		@post:		whether or not the container is empty*/
-template<typename T_>	
-typename bool squarelist<T_>::empty() { 
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename bool squarelist<T_, Compare_, Allocator_, Column_>::empty() { 
 		return this->size_ == 0; 
 }
 /*		@fn:        squarelist<value_type>& operator=(squarelist<value_type> const& rhs);
@@ -346,12 +554,15 @@ typename bool squarelist<T_>::empty() {
 *		@pram:		squarelist<value_type> const& rhs) [in] squarelist to be assigned to this.
 *		@return:		a reference to the squarelist
 *		@pre:		None.
-*		@post:		This squarelist object will contain the data of the RValue*/
-template<typename T_>
-typename squarelist<T_>& squarelist<T_>::operator=(typename squarelist<T_> const& rhs){
+*		@post:		This squarelist object will contain the data of the RValue, shared until one of them writes*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>& squarelist<T_, Compare_, Allocator_, Column_>::operator=(typename squarelist<T_, Compare_, Allocator_, Column_> const& rhs){
 		if(this != &rhs){
+				this->comp_ = rhs.comp_;
+				this->alloc_ = rhs.alloc_;
 				this->size_ = rhs.size_;
 				this->squarelist_ = rhs.squarelist_;
+				this->directory_ = rhs.directory_;
 		}
 		return *this;
 }
@@ -361,151 +572,574 @@ typename squarelist<T_>& squarelist<T_>::operator=(typename squarelist<T_> const
 *		@return:		a reference to the squarelist
 *		@pre:		None.
 *		@post:		The LValue will contain the data of the RValue*/
-template<typename T_>
-typename squarelist<T_>& squarelist<T_>::operator=(typename squarelist<T_> && rhs){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>& squarelist<T_, Compare_, Allocator_, Column_>::operator=(typename squarelist<T_, Compare_, Allocator_, Column_> && rhs){
 		if(this != &rhs){
+				this->comp_ = rhs.comp_;
+				this->alloc_ = rhs.alloc_;
 				this->size_ = rhs.size_;
 				rhs.size_ = 0;
 				this->squarelist_ = rhs.squarelist_;
 				rhs.squarelist_ = nullptr;
+				this->directory_ = std::move(rhs.directory_);
+				rhs.directory_.clear();
 		}
 		return *this;	
 }
-/*		@fn:        inner_list putInVertList(const_reference x);
+/*		@fn:        size_type maxDepth() const;
+*		@brief:		Gets the deepest a vertical list may be for the current size
+*		@pram:		None.
+*		@return:	size_type the ceiling of the square root of the size
+*		@pre:		None.
+*		@post:		Neither a vertical list nor the column directory may grow past this value*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::maxDepth() const{
+		return static_cast<size_type>(std::ceil(std::sqrt( size_ * 1.0 )));
+}
+/*		@fn:        size_type findVertList(const_reference x) const;
+*		@brief:		Finds the vertical list that value X belongs in
+*		@pram:		const_reference x [in] value to be placed
+*		@return:	size_type index of the vertical list in the column directory
+*		@pre:		The column directory must hold at least one vertical list
+*		@post:		The index of the last vertical list whose front is less than X is returned,
+*						or the first vertical list if there is none. Binary search over the directory. */
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::findVertList(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+	auto pos = std::lower_bound(this->directory_.begin() + 1, this->directory_.end(), x,
+			[this](typename outter_list::iterator const& column, const_reference value){ return this->comp_((*column)->front(), value); });
+	return (pos - this->directory_.begin()) - 1;
+}
+/*		@fn:        size_type lowerVertList(const_reference x) const;
+*		@brief:		Finds the first vertical list that could hold a value not less than X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	size_type index of the vertical list in the column directory
+*		@pre:		None
+*		@post:		The index of the first vertical list whose back is not less than X is returned,
+*						or the number of vertical lists if there is none. Binary search over the directory. */
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::lowerVertList(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		if(size_ == 0)
+				return this->directory_.size();
+		return std::lower_bound(this->directory_.begin(), this->directory_.end(), x,
+				[this](typename outter_list::iterator const& column, const_reference value){ return this->comp_((*column)->back(), value); }) - this->directory_.begin();
+}
+/*		@fn:        size_type upperVertList(const_reference x) const;
+*		@brief:		Finds the first vertical list that could hold a value greater than X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	size_type index of the vertical list in the column directory
+*		@pre:		None
+*		@post:		The index of the first vertical list whose back is greater than X is returned,
+*						or the number of vertical lists if there is none. Binary search over the directory. */
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::upperVertList(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		if(size_ == 0)
+				return this->directory_.size();
+		return std::upper_bound(this->directory_.begin(), this->directory_.end(), x,
+				[this](const_reference value, typename outter_list::iterator const& column){ return this->comp_(value, (*column)->back()); }) - this->directory_.begin();
+}
+/*		@fn:        size_type putInVertList(U_&& x);
 *		@brief:		puts Value X in the square list container
-*		@pram:		const_reference x [in] value to be added
+*		@pram:		U_&& x [in] value to be added, moved in when it is an rvalue
 *		@return:	void
 *		@pre:		None
 *		@post:		The ValueX will be added to the container*/
-template< typename T_>
-typename void squarelist<T_>::putInVertList(typename squarelist<T_>::const_reference x){
-	outter_list::iterator nextIter = this->squarelist_->begin();
-	outter_list::iterator iter;
-	for (iter = this->squarelist_->begin(); iter != this->squarelist_->end(); iter++ ) {
-		++nextIter;
-		if ( nextIter == this->squarelist_->end() || x <= (*nextIter)->front()) {
-			for ( list::iterator it = (*iter)->begin(); it != (*iter)->end(); it++ ) {
-				if ( x <= *it ) {
-					(*iter)->insert( it, x );
-					return;
-				}
-				if ( *it == (*iter)->back() ) {
-					(*iter)->push_back( x );
-					return;
-				}
-			}
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template< typename U_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::putInVertList(U_&& x){
+	size_type col = findVertList(x);
+	list& column = ownVertList(this->directory_[col]);
+	for ( list::iterator it = column.begin(); it != column.end(); it++ ) {
+		if ( !this->comp_(*it, x) ) {
+			column.insert( it, std::forward<U_>(x) );
+			return col;
+		}
+		if ( &*it == &column.back() ) {
+			column.push_back( std::forward<U_>(x) );
+			return col;
 		}
-	}	
+	}
+	return col;
 }
 /*		@fn:        bool eraseInVertList(const_reference x);
 *		@brief:		Finds Value X in the square list container and erases it
 *		@pram:		const_reference x [in] value to be found within a the container
 *		@return:		bool indicated if the value was deleted or not.
-*		@pre:		Parameter x should already be in the list
-*		@post:		The x value will be removed form the list*/
-template< typename T_>
-typename bool squarelist<T_>::eraseInVertList(typename squarelist<T_>::const_reference x){
-		for (outter_list::iterator iter = this->squarelist_->begin(); iter != this->squarelist_->end(); iter++ ) {
-				auto pos = std::find((*iter)->begin(), (*iter)->end(), x);
-				if(pos != (*iter)->end()){
-						(*iter)->erase(pos);
-						if(squarelist_->size() == 1 && squarelist_->front()->size() == 0) 
-								return true;
-						else if ((*iter)->size() == 0)
-								squarelist_->erase(iter);				
-
-						return true;
-				}
+*		@pre:		None.
+*		@post:		The x value will be removed form the list, only the vertical list that can hold it is searched*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename bool squarelist<T_, Compare_, Allocator_, Column_>::eraseInVertList(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x){
+		//the first vertical list whose back is not less than x is the only one that can hold it
+		size_type col = lowerVertList(x);
+		if(col == this->directory_.size())
+				return false;
+		typename outter_list::iterator iter = this->directory_[col];
+		auto pos = std::lower_bound((*iter)->begin(), (*iter)->end(), x, this->comp_);
+		if(this->comp_(x, *pos))
+				return false;
+		detach();
+		iter = this->directory_[col];
+		if(!unshared(*iter)){
+				ownVertList(iter);
+				pos = std::lower_bound((*iter)->begin(), (*iter)->end(), x, this->comp_);
+		}
+		(*iter)->erase(pos);
+		if(squarelist_->size() == 1 && squarelist_->front()->size() == 0) 
+				return true;
+		else if ((*iter)->size() == 0){
+				squarelist_->erase(iter);
+				this->directory_.erase(this->directory_.begin() + col);
 		}
-		return false;
+
+		return true;
 }
 
-/*		@fn:        bool eraseInVertList(const_reference x);
-*		@brief:		Finds Value X in the square list container and erases it
-*		@pram:		const_reference x [in] value to be found within a the container
-*		@return:		boolean indicated if the value was deleted or not.
-*		@pre:		Parameter x should already be in the list
-*		@post:		The x value will be removed form the list*/
-template< typename T_>
-typename squarelist<T_>::iterator squarelist<T_>::eraseInVertList(typename squarelist<T_>::iterator x){
-		for (outter_list::iterator iter = this->squarelist_->begin(); iter != this->squarelist_->end(); iter++ ) {	 
-				if(iter == x.head_){
-						auto pos = (*iter)->erase(x.elem_);
-						if(squarelist_->size() == 1 && squarelist_->front()->size() == 0)
-							return this->end();
-						if((*iter)->size() == 0){
-								squarelist_->erase(iter);
-								return this->end();
-						} else 
-								return iterator(iter, x.headStop_, pos);
-				}
-				
-		}
-		return x;
+/*		@fn:        iterator eraseInVertList(iterator x);
+*		@brief:		Erases the value at iterator X from its vertical list
+*		@pram:		iterator x [in] position of the value to be erased
+*		@return:		iterator to the value that followed X, or end()
+*		@pre:		Parameter x should reference a value in the list
+*		@post:		The x value will be removed form the list, its vertical list is dropped if it empties.
+*						The iterator already holds its vertical list so no vertical list is walked to find it*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::eraseInVertList(typename squarelist<T_, Compare_, Allocator_, Column_>::iterator x){
+		typename outter_list::iterator iter = x.head_;
+		auto pos = (*iter)->erase(x.elem_);
+		if(squarelist_->size() == 1 && squarelist_->front()->size() == 0)
+				return this->end();
+		if((*iter)->size() == 0){
+				//only an emptied vertical list costs a directory update
+				this->directory_.erase(std::find(this->directory_.begin(), this->directory_.end(), iter));
+				iter = squarelist_->erase(iter);
+		} else if(pos != (*iter)->end())
+				return iterator(iter, x.headStop_, pos);
+		else
+				++iter;
+
+		if(iter == squarelist_->end())
+				return this->end();
+		return iterator(iter, x.headStop_, (*iter)->begin());
+}
+/*		@fn:        iterator nth(size_type index);
+*		@brief:		Gets an iterator to the value at a position counted from begin()
+*		@pram:		size_type index [in] number of values before the one wanted
+*		@return:		iterator to the value, or end() if index is size()
+*		@pre:		index must not be greater than size()
+*		@post:		An iterator is returned to the client, whole vertical lists are skipped by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::nth(size_type index){
+		if(index >= size_)
+				return this->end();
+		size_type col = 0;
+		while(index >= (*this->directory_[col])->size())
+				index -= (*this->directory_[col++])->size();
+		typename list::iterator elem = (*this->directory_[col])->begin();
+		std::advance(elem, index);
+		return iterator(this->directory_[col], this->squarelist_->end(), elem);
+}
+/*		@fn:        const_iterator nth(size_type index) const;
+*		@brief:		Gets a const_iterator to the value at a position counted from begin()
+*		@pram:		size_type index [in] number of values before the one wanted
+*		@return:		const_iterator to the value, or end() if index is size()
+*		@pre:		index must not be greater than size()
+*		@post:		A const_iterator is returned to the client, whole vertical lists are skipped by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator squarelist<T_, Compare_, Allocator_, Column_>::nth(size_type index) const{
+		if(index >= size_)
+				return this->cend();
+		size_type col = 0;
+		while(index >= (*this->directory_[col])->size())
+				index -= (*this->directory_[col++])->size();
+		typename list::const_iterator elem = (*this->directory_[col])->cbegin();
+		std::advance(elem, index);
+		return const_iterator(this->directory_[col], this->squarelist_->cend(), elem);
+}
+/*		@fn:        const_reference operator[](size_type index) const;
+*		@brief:		Gets the value at a position counted from begin()
+*		@pram:		size_type index [in] number of values before the one wanted
+*		@return:		const_reference to the value
+*		@pre:		index must be less than size()
+*		@post:		The value is returned to the client*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference squarelist<T_, Compare_, Allocator_, Column_>::operator[](size_type index) const{
+		assert(index < size_);
+		return *nth(index);
 }
-/*		@fn:        void shiftLeft(typename outter_list::iterator iter);
-*		@brief:		Moves the last value on the current list back to the previous list
-*		@pram:		squarelist<T_>::outter_list::iterator iter [in] list iterator gather data from
+/*		@fn:        size_type rank(const_reference x) const;
+*		@brief:		Counts the values in the square list that are less than X
+*		@pram:		const_reference x [in] value to be ranked
+*		@return:		size_type number of values less than X
+*		@pre:		None.
+*		@post:		The rank of X is returned, whole vertical lists are counted by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::rank(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		size_type col = lowerVertList(x);
+		if(col == this->directory_.size())
+				return size_;
+		size_type index = 0;
+		for(size_type before = 0; before < col; ++before)
+				index += (*this->directory_[before])->size();
+		inner_list const& column = *this->directory_[col];
+		return index + std::distance(column->cbegin(), std::lower_bound(column->cbegin(), column->cend(), x, this->comp_));
+}
+/*		@fn:        size_type index_of(const_iterator x) const;
+*		@brief:		Gets the position of iterator X counted from begin()
+*		@pram:		const_iterator x [in] position to be counted
+*		@return:		size_type number of values before X
+*		@pre:		Parameter x must belong to this square list
+*		@post:		The position of X is returned, end() is at size()*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::index_of(typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator x) const{
+		return size_ - x.remaining();
+}
+/*		@fn:        void shiftLeft(size_type col);
+*		@brief:		Moves the first value on the next list back to the current list
+*		@pram:		size_type col [in] column directory index of the current list
 *		@return:		void
-*		@pre:		A List iterator with a valid current and previous positions
-*		@post:		Moves value the previous list*/
-template< typename T_>
-void squarelist<T_>::shiftLeft(typename squarelist<T_>::outter_list::iterator iter ){
-		auto tempIter = iter++;
-		if(iter == squarelist_->end()){
-				--iter;
-		} else {
-				value_type temp = (*iter)->front();
-				(*iter)->pop_front();
+*		@pre:		col must index a list in the column directory
+*		@post:		Moves value to the current list, the next list is dropped if it empties.
+*						The node is relinked so nothing is copied or allocated*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::shiftLeft(size_type col){
+		if(col + 1 == this->directory_.size())
+				return;
+		typename outter_list::iterator next = this->directory_[col + 1];
+		list& current = ownVertList(this->directory_[col]);
+		ownVertList(next);
+		current.splice(current.end(), **next, (*next)->begin());
+		++shifts_;
 
-				if((*iter)->size() == 0){
-						squarelist_->erase(iter);
-						iter = tempIter;
-				}
-				else
-						--iter;
-				(*(iter))->push_back(temp);
+		if((*next)->size() == 0){
+				squarelist_->erase(next);
+				this->directory_.erase(this->directory_.begin() + col + 1);
 		}
 }
-/*		@fn:        void shiftLeft(typename outter_list::iterator iter);
+/*		@fn:        void shiftRight(size_type col);
 *		@brief:		Moves the last value on the current list forward to the next list
-*		@pram:		squarelist<T_>::outter_list::iterator iter [in] list iterator gather data from
+*		@pram:		size_type col [in] column directory index of the current list
 *		@return:		void
-*		@pre:		A List iterator with a valid current and next positions
-*		@post:		Moves value the next list*/
-template< typename T_>
-void squarelist<T_>::shiftRight(typename squarelist<T_>::outter_list::iterator iter ){
-		value_type temp = (*iter)->back();
-		(*iter++)->pop_back();				
-		if(iter == squarelist_->end()){
-				this->squarelist_->push_back(inner_list(new list()));
-				this->squarelist_->back()->push_front(temp);
-				--iter;
-		} else {
-				(*iter)->push_front(temp);
-				--iter;
-		}	
+*		@pre:		col must index a non empty list in the column directory
+*		@post:		Moves value to the next list, a new list is appended if there is no next list.
+*						The node is relinked so nothing is copied or allocated*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::shiftRight(size_type col){
+		if(col + 1 == this->directory_.size())
+				appendVertList();
+		list& current = ownVertList(this->directory_[col]);
+		list& next = ownVertList(this->directory_[col + 1]);
+		next.splice(next.begin(), current, --current.end());
+		++shifts_;
+}
+/*		@fn:        void splitVertList(size_type col);
+*		@brief:		Moves the back half of a vertical list to a new vertical list opened after it
+*		@pram:		size_type col [in] column directory index of the list to split
+*		@return:		void
+*		@pre:		col must index a list holding at least two values, and there must be fewer vertical lists than maxDepth
+*		@post:		Both halves are in the column directory in order, no other vertical list is touched*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::splitVertList(size_type col){
+		typename outter_list::iterator column = this->directory_[col];
+		typename outter_list::iterator next = column;
+		next = this->squarelist_->insert(++next, newVertList());
+		this->directory_.insert(this->directory_.begin() + col + 1, next);
+		list& current = ownVertList(column);
+		typename list::iterator middle = current.begin();
+		std::advance(middle, current.size() / 2);
+		(*next)->splice((*next)->end(), current, middle, current.end());
+}
+/*		@fn:        outter_list::iterator appendVertList();
+*		@brief:		Adds an empty vertical list after the last one
+*		@pram:		None.
+*		@return:	outter_list::iterator to the new vertical list
+*		@pre:		None.
+*		@post:		The new vertical list is the last one in the square list and in the column directory*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::iterator squarelist<T_, Compare_, Allocator_, Column_>::appendVertList(){
+		this->squarelist_->push_back(newVertList());
+		typename outter_list::iterator last = this->squarelist_->end();
+		this->directory_.push_back(--last);
+		return last;
+}
+/*		@fn:        void rebuildDirectory();
+*		@brief:		Registers every vertical list in the column directory again
+*		@pram:		None.
+*		@return:	void
+*		@pre:		None.
+*		@post:		The column directory holds the vertical lists of the square list in order*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::rebuildDirectory(){
+		this->directory_.clear();
+		for(typename outter_list::iterator column = this->squarelist_->begin(); column != this->squarelist_->end(); ++column)
+				this->directory_.push_back(column);
+}
+/*		@fn:        void squareUp();
+*		@brief:		Lays the square list out again if it is no longer square
+*		@pram:		None.
+*		@return:	void
+*		@pre:		The column directory must hold the vertical lists in order
+*		@post:		Neither a vertical list nor the column directory is deeper than the max depth.
+*						Vertical lists that already fit are kept whole, no value is copied*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::squareUp(){
+		size_type depth = this->maxDepth();
+		bool square = this->directory_.size() <= depth;
+		for(size_type col = 0; square && col < this->directory_.size(); ++col)
+				square = (*this->directory_[col])->size() <= depth;
+		if(!square)
+				layOut();
+}
+/*		@fn:        static bool unshared(std::shared_ptr<P_> const& shared);
+*		@brief:		Checks that no copy shares a column or the outer list, before it is written in place or moved from
+*		@pram:		std::shared_ptr<P_> const& shared [in] storage about to be written
+*		@return:	bool true when SHARED is its storage's only owner
+*		@pre:		None.
+*		@post:		use_count is a relaxed load, so when it reads 1 an acquire fence orders the reads a copy
+*						made on another thread before dropping its share ahead of the writes that follow*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template<typename P_>
+bool squarelist<T_, Compare_, Allocator_, Column_>::unshared(std::shared_ptr<P_> const& shared){
+		if(shared.use_count() != 1)
+				return false;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return true;
+}
+/*		@fn:        void detach();
+*		@brief:		Gives this square list its own outer list before it writes
+*		@pram:		None.
+*		@return:	void
+*		@pre:		None.
+*		@post:		The outer list is no longer shared with a copy. The vertical lists are not cloned,
+*						the new outer list shares them until ownVertList is called on one*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::detach(){
+		if(unshared(this->squarelist_))
+				return;
+		squarelist_container shared = this->squarelist_;
+		this->squarelist_ = newContainer();
+		for(typename outter_list::iterator column = shared->begin(); column != shared->end(); ++column)
+				this->squarelist_->push_back(*column);
+		rebuildDirectory();
+}
+/*		@fn:        list& ownVertList(outter_list::iterator column);
+*		@brief:		Gives this square list its own copy of a vertical list before it writes to it
+*		@pram:		outter_list::iterator column [in] vertical list about to be written
+*		@return:	list& the vertical list, safe to write
+*		@pre:		detach() must have been called so COLUMN belongs to this square list's outer list
+*		@post:		The vertical list is cloned only when a copy still shares it, iterators into it are then invalidated*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::list& squarelist<T_, Compare_, Allocator_, Column_>::ownVertList(typename outter_list::iterator column){
+		if(!unshared(*column))
+				*column = std::allocate_shared<list>(alloc_, **column);
+		return **column;
+}
+/*		@fn:        iterator ownPosition(iterator x);
+*		@brief:		Gives this square list its own storage under X before X is written through
+*		@pram:		iterator x [in] position about to be erased
+*		@return:	iterator to the same position in storage this square list owns
+*		@pre:		Parameter x must belong to this square list or a copy sharing its storage
+*		@post:		X is returned unchanged when nothing under it is shared, otherwise it is found again by index*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::ownPosition(typename squarelist<T_, Compare_, Allocator_, Column_>::iterator x){
+		if(unshared(this->squarelist_) && x.headStop_ == this->squarelist_->end()
+			&& (x.head_ == this->squarelist_->end() || unshared(*x.head_)))
+				return x;
+		size_type index = this->index_of(x);
+		detach();
+		iterator pos = this->nth(index);
+		if(pos.head_ != this->squarelist_->end() && !unshared(*pos.head_)){
+				ownVertList(pos.head_);
+				pos = this->nth(index);
+		}
+		return pos;
+}
+/*		@fn:        void skipEmptyVertLists(outter_list& source, outter_list::iterator& col, list::iterator& pos);
+*		@brief:		Moves POS past the end of any vertical lists of SOURCE it has run off
+*		@pram:		outter_list& source [in] outer list being read
+*					outter_list::iterator& col [in/out] vertical list of SOURCE holding POS
+*					list::iterator& pos [in/out] position being read
+*		@return:	void
+*		@pre:		None.
+*		@post:		POS references a value of SOURCE or COL is the end of SOURCE*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::skipEmptyVertLists(outter_list& source, typename outter_list::iterator& col, typename list::iterator& pos){
+		while(col != source.end() && pos == (*col)->end())
+				if(++col != source.end())
+						pos = (*col)->begin();
+}
+/*		@fn:        void layOut();
+*		@brief:		Lays the values of the square list out again in full vertical lists
+*		@pram:		None.
+*		@return:	void
+*		@pre:		None.
+*		@post:		Every vertical list but the last holds maxDepth values. A vertical list that already fits
+*						where it lands is kept whole, the values of the others are spliced or moved, never copied
+*						unless a copy shares them, and emptied vertical lists are freed as they are passed*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::layOut(){
+		bool move = unshared(this->squarelist_);
+		squarelist_container source = this->squarelist_;
+		typename outter_list::iterator col = source->begin();
+		typename list::iterator pos = (*col)->begin();
+		skipEmptyVertLists(*source, col, pos);
+
+		size_type depth = this->maxDepth();
+		this->squarelist_ = newContainer();
+		this->directory_.clear();
+		do{
+				if(col != source->end() && pos == (*col)->begin()
+					&& ((*col)->size() == depth || ((*col)->size() < depth && std::next(col) == source->end()))){
+						this->squarelist_->push_back(*col);
+						typename outter_list::iterator last = this->squarelist_->end();
+						this->directory_.push_back(--last);
+						pos = (*col)->end();
+						skipEmptyVertLists(*source, col, pos);
+				} else {
+						inner_list& column = *appendVertList();
+						for(size_type taken = 0; taken < depth && col != source->end(); ++taken)
+								takeValue(*column, *source, col, pos, move);
+				}
+				//vertical lists already read are dropped so the old layout is not held until the end
+				if(move)
+						while(source->begin() != col)
+								source->pop_front();
+		}while(col != source->end());
+}
+/*		@fn:        void mergeLayOut(squarelist_container rhs, size_type count, bool moveRhs);
+*		@brief:		Merges the values of RHS with the values of this square list into full vertical lists
+*		@pram:		squarelist_container rhs [in] sorted outer list to merge with
+*					size_type count [in] number of values in RHS
+*					bool moveRhs [in] whether RHS may give up its values
+*		@return:	void
+*		@pre:		None.
+*		@post:		The square list holds both sequences in order, every vertical list but the last is full.
+*						This square list gives up its values only when no copy shares them*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::mergeLayOut(squarelist_container rhs, size_type count, bool moveRhs){
+		bool moveLhs = unshared(this->squarelist_);
+		squarelist_container lhs = this->squarelist_;
+		typename outter_list::iterator lcol = lhs->begin(), rcol = rhs->begin();
+		typename list::iterator lpos = (*lcol)->begin(), rpos = (*rcol)->begin();
+		skipEmptyVertLists(*lhs, lcol, lpos);
+		skipEmptyVertLists(*rhs, rcol, rpos);
+
+		this->size_ += count;
+		size_type depth = this->maxDepth();
+		this->squarelist_ = newContainer();
+		this->directory_.clear();
+		do{
+				inner_list& column = *appendVertList();
+				for(size_type taken = 0; taken < depth && (lcol != lhs->end() || rcol != rhs->end()); ++taken){
+						//equal values already in the square list stay in front of the merged ones
+						if(rcol == rhs->end() || (lcol != lhs->end() && !this->comp_(*rpos, *lpos)))
+								takeValue(*column, *lhs, lcol, lpos, moveLhs);
+						else
+								takeValue(*column, *rhs, rcol, rpos, moveRhs);
+				}
+		}while(lcol != lhs->end() || rcol != rhs->end());
+}
+/*		@fn:        void takeValue(list& column, outter_list& source, outter_list::iterator& col, list::iterator& pos, bool move);
+*		@brief:		Appends the value at POS to COLUMN and steps POS to the next value of SOURCE
+*		@pram:		list& column [in/out] vertical list to append to
+*					outter_list& source [in] outer list being read
+*					outter_list::iterator& col [in/out] vertical list of SOURCE holding POS
+*					list::iterator& pos [in/out] value to be taken
+*					bool move [in] whether SOURCE may give up its values
+*		@return:	void
+*		@pre:		POS must reference a value of SOURCE
+*		@post:		The value is at the back of COLUMN, moved values are spliced so their nodes are reused*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::takeValue(list& column, outter_list& source, typename outter_list::iterator& col, typename list::iterator& pos, bool move){
+		//a vertical list still shared with a copy is read from, never given up
+		if(move && unshared(*col))
+				relinkValue(column, **col, pos++);
+		else
+				column.push_back(*pos++);
+		skipEmptyVertLists(source, col, pos);
+}
+/*		@fn:        void relinkValue(dlist<T_, A_>& column, dlist<T_, A_>& source, dlist<T_, A_>::iterator pos);
+*		@brief:		Splices the node at POS onto the back of COLUMN
+*		@pram:		dlist<T_, A_>& column [in/out] vertical list to append to
+*					dlist<T_, A_>& source [in/out] vertical list holding POS
+*					dlist<T_, A_>::iterator pos [in] value to be taken
+*		@return:	void
+*		@pre:		POS must reference a value of SOURCE
+*		@post:		The node is reused, no value is copied or allocated*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template<typename A_>
+void squarelist<T_, Compare_, Allocator_, Column_>::relinkValue(dlist<T_, A_>& column, dlist<T_, A_>& source, typename dlist<T_, A_>::iterator pos){
+		column.splice(column.end(), source, pos);
+}
+/*		@fn:        void relinkValue(List_& column, List_& source, List_::iterator pos);
+*		@brief:		Moves the value at POS onto the back of COLUMN
+*		@pram:		List_& column [in/out] vertical list to append to
+*					List_& source [in] vertical list holding POS
+*					List_::iterator pos [in] value to be taken
+*		@return:	void
+*		@pre:		POS must reference a value of SOURCE, SOURCE is thrown away once it is read
+*		@post:		The moved from value is left in SOURCE so the values after POS stay where they are,
+*						columns that pack several values in a node would otherwise slide them under POS*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template<typename List_>
+void squarelist<T_, Compare_, Allocator_, Column_>::relinkValue(List_& column, List_&, typename List_::iterator pos){
+		column.push_back(std::move(*pos));
 }
 /*		@fn:        void balance()
-*		@brief:		Balances the square list container to a square or near square form
+*		@brief:		Balances the square list container to a square or near square form by sweeping 
+*						every vertical list. Only needed when maxDepth shrinks or after bulk changes.
 *		@pram:		None.
 *		@return:		void
 *		@pre:		None
-*		@post:		the square list container will be balanced to a square or near square form*/
-template< typename T_>
-void squarelist<T_>::balance(){
-		size_type maxDepth = static_cast<int>(std::ceil(std::sqrt( size_ * 1.0 )));
-		for(outter_list::iterator iter = squarelist_->begin(); iter != squarelist_->end(); iter++){
-				if((*iter)->size() == maxDepth){
-					continue;
-				} else if ((*iter)->size() > maxDepth){
-						while((*iter)->size() > maxDepth)
-								shiftRight(iter);
-				} else if ((*iter)->size() < maxDepth){
-					shiftLeft(iter);
-				} 		
+*		@post:		every vertical list but the last will hold exactly maxDepth values*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::balance(){
+		size_type maxDepth = this->maxDepth();
+		for(size_type col = 0; col < this->directory_.size(); ++col){
+				while((*this->directory_[col])->size() > maxDepth)
+						shiftRight(col);
+				while((*this->directory_[col])->size() < maxDepth && col + 1 < this->directory_.size())
+						shiftLeft(col);
 		}  
 }
+/*		@fn:        void balance(size_type col)
+*		@brief:		Restores the square form after a value was put in one vertical list.
+*						The extra value is passed toward the nearest vertical list with room,
+*						or a new vertical list at the end, so only the vertical lists in between are touched.
+*						A list whose next list is full and shared with another version is split in place instead.
+*		@pram:		size_type col [in] column directory index of the vertical list that grew
+*		@return:		void
+*		@pre:		Every other vertical list is within maxDepth
+*		@post:		the square list container will be balanced to a square or near square form*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::balance(size_type col){
+		size_type maxDepth = this->maxDepth();
+		if((*this->directory_[col])->size() <= maxDepth)
+				return;
+		//opening a new vertical list at the end is allowed while there are fewer than maxDepth
+		size_type last = this->directory_.size();
+		size_type open = last < maxDepth ? last - col : static_cast<size_type>(-1);
+		//every full vertical list shifted through that another version still shares would be cloned,
+		//so while a vertical list can be opened the full one is split in place instead
+		if(last < maxDepth && col + 1 < last && !unshared(*this->directory_[col + 1])
+			&& (*this->directory_[col + 1])->size() >= maxDepth){
+				splitVertList(col);
+				return;
+		}
+		for(size_type dist = 1; dist < open && (col + dist < last || dist <= col); ++dist){
+				if(col + dist < last && (*this->directory_[col + dist])->size() < maxDepth){
+						for(size_type next = col; next < col + dist; ++next)
+								shiftRight(next);
+						return;
+				}
+				if(dist <= col && (*this->directory_[col - dist])->size() < maxDepth){
+						for(size_type prev = col; prev > col - dist; --prev)
+								shiftLeft(prev - 1);
+						return;
+				}
+		}
+		//no vertical list with room is nearer than the end, so open a new one there
+		assert(last < maxDepth);
+		for(size_type next = col; next < last; ++next)
+				shiftRight(next);
+}
 
 /*		@fn:        void insert(const_reference x)
 *		@brief:		Inserts an element to the squqre list while keeping it sorted and balanced 
@@ -514,24 +1148,198 @@ void squarelist<T_>::balance(){
 *		@return:		void
 *		@pre:		A squarelist object must be created and a valid type must be passed in to this method
 *		@post:		value will be added and the squarelist will be sorted and squared*/
-template<typename T_>
-void squarelist<T_>::insert(typename squarelist<T_>::const_reference x ){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::insert(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x ){
+		insertValue(x);
+}
+/*		@fn:        void insert(value_type&& x)
+*		@brief:		Moves an element into the squqre list while keeping it sorted and balanced 
+*						in a square or near square form.
+*		@pram:		value_type&& x [in] value to be moved in
+*		@return:		void
+*		@pre:		A squarelist object must be created and a valid type must be passed in to this method
+*		@post:		value will be added without a copy and the squarelist will be sorted and squared*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::insert(typename squarelist<T_, Compare_, Allocator_, Column_>::value_type&& x ){
+		insertValue(std::move(x));
+}
+/*		@fn:        void emplace(Args&&... args)
+*		@brief:		Constructs an element and moves it into the squqre list while keeping it sorted and balanced 
+*						in a square or near square form.
+*		@pram:		Args&&... args [in] arguments forwarded to the value's constructor
+*		@return:		void
+*		@pre:		A squarelist object must be created and a valid type must be passed in to this method
+*		@post:		value will be added and the squarelist will be sorted and squared*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template<typename... Args>
+void squarelist<T_, Compare_, Allocator_, Column_>::emplace(Args&&... args){
+		insertValue(value_type(std::forward<Args>(args)...));
+}
+/*		@fn:        void insertValue(U_&& x)
+*		@brief:		Inserts an element to the squqre list while keeping it sorted and balanced 
+*						in a square or near square form.
+*		@pram:		U_&& x [in] value to be added, moved in when it is an rvalue
+*		@return:		void
+*		@pre:		A squarelist object must be created and a valid type must be passed in to this method
+*		@post:		value will be added and the squarelist will be sorted and squared*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template<typename U_>
+void squarelist<T_, Compare_, Allocator_, Column_>::insertValue(U_&& x ){
 #if defined (_DEBUG)
 		assert(is_sorted());
 		assert(is_square());
 #endif
+		detach();
+		size_type col = 0;
 		if(size_ == 0) {
-				this->squarelist_->front()->push_back(x);
+				ownVertList(this->squarelist_->begin()).push_back(std::forward<U_>(x));
 		}else{
-				putInVertList( x );
+				col = putInVertList( std::forward<U_>(x) );
 		}		
 		++size_;
-		balance();
+		balance(col);
 #if defined (_DEBUG)
 		assert(is_sorted());
 		assert(is_square());
 #endif
-} 
+}
+/*		@fn:        void insert(InputIterator first, InputIterator last)
+*		@brief:		inserts a range of values into the square list while keeping it sorted and balanced 
+*						in a square or near square form.
+*		@pram:		InputIterator first [in] first value to be inserted
+*					InputIterator last [in] one past the last value to be inserted
+*		@return:	void
+*		@pre:		None, the range does not need to be sorted
+*		@post:		the values are inserted and the squarelist is sorted and squared.
+*						The sorted batch is merged with the current values into full vertical lists in one pass,
+*						so the square list is laid out once instead of balanced once per value*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+template<typename InputIterator>
+void squarelist<T_, Compare_, Allocator_, Column_>::insert(InputIterator first, InputIterator last){
+		std::vector<value_type, Allocator_> batch(first, last, alloc_);
+		if(batch.empty())
+				return;
+		std::sort(batch.begin(), batch.end(), this->comp_);
+		this->merge(squarelist<T_, Compare_, Allocator_, Column_>(batch.begin(), batch.end(), comp_, alloc_));
+}
+/*		@fn:        void merge(squarelist<value_type> && other)
+*		@brief:		Moves every value of OTHER into the square list
+*		@pram:		squarelist<value_type> && other [in] square list to be merged in
+*		@return:	void
+*		@pre:		None.
+*		@post:		the squarelist holds both sequences and is sorted and squared, OTHER is empty.
+*						Both sequences are streamed into new vertical lists in O(n + m)*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::merge(squarelist<T_, Compare_, Allocator_, Column_> && other){
+		if(this == &other || other.size_ == 0)
+				return;
+		size_type count = other.size_;
+		squarelist_container rhs = other.squarelist_;
+		other = squarelist<T_, Compare_, Allocator_, Column_>(other.comp_, other.alloc_);
+		mergeLayOut(rhs, count, unshared(rhs));
+	#if defined (_DEBUG)
+			assert(is_sorted());
+			assert(is_square());
+	#endif
+}
+/*		@fn:        void merge(squarelist<value_type> const& other)
+*		@brief:		Copies every value of OTHER into the square list
+*		@pram:		squarelist<value_type> const& other [in] square list to be merged in
+*		@return:	void
+*		@pre:		None.
+*		@post:		the squarelist holds both sequences and is sorted and squared, OTHER is unchanged.
+*						Both sequences are streamed into new vertical lists in O(n + m)*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::merge(squarelist<T_, Compare_, Allocator_, Column_> const& other){
+		if(other.size_ == 0)
+				return;
+		mergeLayOut(other.squarelist_, other.size_, false);
+	#if defined (_DEBUG)
+			assert(is_sorted());
+			assert(is_square());
+	#endif
+}
+/*		@fn:        squarelist<value_type> split(const_reference key)
+*		@brief:		Splits the square list at KEY
+*		@pram:		const_reference key [in] smallest value to be split off
+*		@return:	squarelist<value_type> holding every value not less than KEY
+*		@pre:		None.
+*		@post:		this squarelist keeps the values less than KEY, both square lists are sorted and squared.
+*						Whole vertical lists are handed over without touching their values, only the boundary list is split*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+squarelist<T_, Compare_, Allocator_, Column_> squarelist<T_, Compare_, Allocator_, Column_>::split(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference key){
+	#if defined (_DEBUG)
+			assert(is_sorted());
+			assert(is_square());
+	#endif
+		squarelist<T_, Compare_, Allocator_, Column_> result(comp_, alloc_);
+		size_type col = lowerVertList(key);
+		if(col == this->directory_.size())
+				return result;
+		size_type index = this->rank(key);
+		detach();
+		typename outter_list::iterator column = this->directory_[col];
+		typename list::iterator pos = std::lower_bound((*column)->begin(), (*column)->end(), key, this->comp_);
+		if(pos != (*column)->begin()){
+				if(!unshared(*column)){
+						ownVertList(column);
+						pos = std::lower_bound((*column)->begin(), (*column)->end(), key, this->comp_);
+				}
+				list& front = *result.squarelist_->front();
+				front.splice(front.end(), **column, pos, (*column)->end());
+				++column;
+		} else
+				result.squarelist_->clear();
+		while(column != this->squarelist_->end()){
+				result.squarelist_->push_back(*column);
+				column = this->squarelist_->erase(column);
+		}
+
+		result.size_ = this->size_ - index;
+		this->size_ = index;
+		if(this->squarelist_->empty())
+				this->squarelist_->push_back(newVertList());
+		this->rebuildDirectory();
+		result.rebuildDirectory();
+		this->squareUp();
+		result.squareUp();
+	#if defined (_DEBUG)
+			assert(is_sorted());
+			assert(is_square());
+			assert(result.is_sorted());
+			assert(result.is_square());
+	#endif
+		return result;
+}
+/*		@fn:        void join(squarelist<value_type> && other)
+*		@brief:		Appends the values of OTHER to the square list
+*		@pram:		squarelist<value_type> && other [in] square list whose values are not less than any value of this one
+*		@return:	void
+*		@pre:		every value of OTHER must be not less than every value of this square list
+*		@post:		the squarelist holds both sequences and is sorted and squared, OTHER is empty.
+*						The vertical lists of OTHER are handed over without touching their values*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::join(squarelist<T_, Compare_, Allocator_, Column_> && other){
+		if(this == &other || other.size_ == 0)
+				return;
+		assert(!(this->size_ != 0 && this->comp_(other.front(), this->back())));
+		if(this->size_ == 0){
+				*this = std::move(other);
+				other = squarelist<T_, Compare_, Allocator_, Column_>(other.comp_, other.alloc_);
+				return;
+		}
+		this->detach();
+		for(typename outter_list::iterator column = other.squarelist_->begin(); column != other.squarelist_->end(); ++column)
+				this->squarelist_->push_back(*column);
+		this->size_ += other.size_;
+		other = squarelist<T_, Compare_, Allocator_, Column_>(other.comp_, other.alloc_);
+		this->rebuildDirectory();
+		this->squareUp();
+	#if defined (_DEBUG)
+			assert(is_sorted());
+			assert(is_square());
+	#endif
+}
 
 /*		@fn:		void erase(const_reference x)
 *		@brief:		erase an element to the squqre list while keeping it sorted and balanced 
@@ -540,12 +1348,13 @@ void squarelist<T_>::insert(typename squarelist<T_>::const_reference x ){
 *		@return:	bool - indicating if the value was erased
 *		@pre:		the squarelist object must have at least one value in it and a valid type must be passed in to this method
 *		@post:		value will be erased and the squarelist will be sorted and squared*/
-template<typename T_>
-bool squarelist<T_>::erase(typename squarelist<T_>::const_reference x ){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist<T_, Compare_, Allocator_, Column_>::erase(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x ){
 	#if defined (_DEBUG)
 			assert(is_sorted());
 			assert(is_square());
 	#endif
+		size_type maxDepth = this->maxDepth();
 		if(size_ == 0) {
 				return false;
 		}else{
@@ -553,7 +1362,8 @@ bool squarelist<T_>::erase(typename squarelist<T_>::const_reference x ){
 					return false;
 		}		
 		--size_;
-		balance();
+		if(this->maxDepth() < maxDepth)
+				balance();
 	#if defined (_DEBUG)
 			assert(is_sorted());
 			assert(is_square());
@@ -562,15 +1372,43 @@ bool squarelist<T_>::erase(typename squarelist<T_>::const_reference x ){
 	return true;
 }
 
-/*		@fn:        void erase(iterator x)
+/*		@fn:        squarelist<value_type> inserted(const_reference x) const
+*		@brief:		Makes a new version of the square list that also holds X
+*		@pram:		const_reference x [in] value to be added
+*		@return:	squarelist<value_type> the new version
+*		@pre:		None.
+*		@post:		This version is unchanged and stays readable. The new version shares every vertical list
+*						the insert does not touch with it, only the outer list and the vertical lists
+*						from X to the nearest one with room are cloned*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+squarelist<T_, Compare_, Allocator_, Column_> squarelist<T_, Compare_, Allocator_, Column_>::inserted(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		squarelist<T_, Compare_, Allocator_, Column_> version(*this);
+		version.insert(x);
+		return version;
+}
+/*		@fn:        squarelist<value_type> erased(const_reference x) const
+*		@brief:		Makes a new version of the square list without one X
+*		@pram:		const_reference x [in] value to be erased
+*		@return:	squarelist<value_type> the new version, sharing all its storage with this one if X is not held
+*		@pre:		None.
+*		@post:		This version is unchanged and stays readable. Only the vertical list X is erased from is cloned,
+*						unless the max depth shrinks and every vertical list is balanced again*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+squarelist<T_, Compare_, Allocator_, Column_> squarelist<T_, Compare_, Allocator_, Column_>::erased(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		squarelist<T_, Compare_, Allocator_, Column_> version(*this);
+		version.erase(x);
+		return version;
+}
+
+/*		@fn:        iterator erase(iterator x)
 *		@brief:		erase an element to the square list while keeping it sorted and balanced 
 *						in a square or near square form.
 *		@pram:		iterator x [in] value to be erased
-*		@return:		void
+*		@return:		iterator to the value that followed x, or end()
 *		@pre:		the squarelist object must have at least one value in it and a valid type must be passed in to this method
 *		@post:		value will be erased and the squarelist will be sorted and squared*/
-template<typename T_>
-typename squarelist<T_>::iterator squarelist<T_>::erase(typename squarelist<T_>::iterator x ){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::erase(typename squarelist<T_, Compare_, Allocator_, Column_>::iterator x ){
 	assert(!(size_ == 0));
 	assert(!(this->squarelist_->end() != x.headStop_));
 	assert(!(x == this->end()));
@@ -579,13 +1417,19 @@ typename squarelist<T_>::iterator squarelist<T_>::erase(typename squarelist<T_>:
 			assert(is_square());
 	#endif
 		iterator pos;
+		size_type maxDepth = this->maxDepth();
 		if(size_ == 0) {
 				return end();
 		}else{
-				pos = eraseInVertList(x);
+				pos = eraseInVertList(ownPosition(x));
 		}		
 		--size_;
-		balance();
+		if(this->maxDepth() < maxDepth){
+				//balancing moves values between vertical lists so find the successor again
+				size_type index = this->index_of(pos);
+				balance();
+				pos = this->nth(index);
+		}
 	#if defined (_DEBUG)
 			assert(is_sorted());
 			assert(is_square());
@@ -593,6 +1437,202 @@ typename squarelist<T_>::iterator squarelist<T_>::erase(typename squarelist<T_>:
 
 		return pos;
 }
+/*		@fn:        iterator erase(iterator first, iterator last)
+*		@brief:		erases a range of values from the square list while keeping it sorted and balanced 
+*						in a square or near square form.
+*		@pram:		iterator first [in] first value to be erased
+*					iterator last [in] one past the last value to be erased
+*		@return:		iterator to the value that followed the range, or end()
+*		@pre:		the range must belong to this square list
+*		@post:		the values are erased and the squarelist is sorted and squared.
+*						Vertical lists covered by the range are unlinked whole, only the two boundary lists are trimmed,
+*						and the remaining vertical lists are laid out again once if the max depth shrank*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::erase(typename squarelist<T_, Compare_, Allocator_, Column_>::iterator first, typename squarelist<T_, Compare_, Allocator_, Column_>::iterator last){
+	#if defined (_DEBUG)
+			assert(is_sorted());
+			assert(is_square());
+	#endif
+		if(first == last)
+				return last;
+		size_type maxDepth = this->maxDepth();
+		size_type index = this->index_of(first);
+		size_type count = last - first;
+		first = ownPosition(first);
+		last = ownPosition(this->nth(index + count));
+		this->size_ -= count;
+
+		typename outter_list::iterator column = first.head_;
+		//values are counted before erasing, an erase may move the values after it within their node
+		if(column == last.head_){
+				typename list::iterator pos = first.elem_;
+				for(difference_type count = std::distance(first.elem_, last.elem_); count != 0; --count)
+						pos = (*column)->erase(pos);
+		} else {
+				for(typename list::iterator pos = first.elem_; pos != (*column)->end();)
+						pos = (*column)->erase(pos);
+				for(typename outter_list::iterator covered = std::next(column); covered != last.head_;)
+						covered = this->squarelist_->erase(covered);
+				if(last.head_ != this->squarelist_->end()){
+						typename list::iterator pos = (*last.head_)->begin();
+						for(difference_type count = std::distance(pos, last.elem_); count != 0; --count)
+								pos = (*last.head_)->erase(pos);
+				}
+		}
+		if((*column)->empty())
+				this->squarelist_->erase(column);
+		if(this->squarelist_->empty())
+				this->squarelist_->push_back(newVertList());
+		rebuildDirectory();
+
+		if(this->maxDepth() < maxDepth)
+				layOut();
+	#if defined (_DEBUG)
+			assert(is_sorted());
+			assert(is_square());
+	#endif
+		return this->nth(index);
+}
+/*		@fn:        size_type erase_range(const_reference lo, const_reference hi)
+*		@brief:		erases the values from lo up to but not including hi from the square list
+*		@pram:		const_reference lo [in] smallest value to be erased
+*					const_reference hi [in] values not less than hi are kept
+*		@return:		size_type number of values erased
+*		@pre:		None.
+*		@post:		the values are erased and the squarelist is sorted and squared*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::erase_range(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference lo, typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference hi){
+		if(!this->comp_(lo, hi))
+				return 0;
+		iterator first = this->lower_bound(lo);
+		iterator last = this->lower_bound(hi);
+		size_type count = last - first;
+		this->erase(first, last);
+		return count;
+}
+/*		@fn:        iterator lower_bound(const_reference x);
+*		@brief:		Finds the first value in the square list that is not less than X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	iterator to the first value not less than X, or end()
+*		@pre:		None.
+*		@post:		Only the one vertical list that can hold X is searched*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::lower_bound(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x){
+		size_type col = lowerVertList(x);
+		if(col == this->directory_.size())
+				return this->end();
+		inner_list& column = *this->directory_[col];
+		return iterator(this->directory_[col], this->squarelist_->end(), std::lower_bound(column->begin(), column->end(), x, this->comp_));
+}
+/*		@fn:        const_iterator lower_bound(const_reference x) const;
+*		@brief:		Finds the first value in the square list that is not less than X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	const_iterator to the first value not less than X, or end()
+*		@pre:		None.
+*		@post:		Only the one vertical list that can hold X is searched*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator squarelist<T_, Compare_, Allocator_, Column_>::lower_bound(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		size_type col = lowerVertList(x);
+		if(col == this->directory_.size())
+				return this->cend();
+		inner_list const& column = *this->directory_[col];
+		return const_iterator(this->directory_[col], this->squarelist_->cend(), std::lower_bound(column->cbegin(), column->cend(), x, this->comp_));
+}
+/*		@fn:        iterator upper_bound(const_reference x);
+*		@brief:		Finds the first value in the square list that is greater than X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	iterator to the first value greater than X, or end()
+*		@pre:		None.
+*		@post:		Only the one vertical list that can hold X is searched*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::upper_bound(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x){
+		size_type col = upperVertList(x);
+		if(col == this->directory_.size())
+				return this->end();
+		inner_list& column = *this->directory_[col];
+		return iterator(this->directory_[col], this->squarelist_->end(), std::upper_bound(column->begin(), column->end(), x, this->comp_));
+}
+/*		@fn:        const_iterator upper_bound(const_reference x) const;
+*		@brief:		Finds the first value in the square list that is greater than X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	const_iterator to the first value greater than X, or end()
+*		@pre:		None.
+*		@post:		Only the one vertical list that can hold X is searched*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator squarelist<T_, Compare_, Allocator_, Column_>::upper_bound(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		size_type col = upperVertList(x);
+		if(col == this->directory_.size())
+				return this->cend();
+		inner_list const& column = *this->directory_[col];
+		return const_iterator(this->directory_[col], this->squarelist_->cend(), std::upper_bound(column->cbegin(), column->cend(), x, this->comp_));
+}
+/*		@fn:        std::pair<iterator, iterator> equal_range(const_reference x);
+*		@brief:		Finds the range of values in the square list that are equal to X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	pair of iterators, the lower_bound and upper_bound of X
+*		@pre:		None.
+*		@post:		The range is returned to the client, it is empty if X is not in the square list*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+std::pair<typename squarelist<T_, Compare_, Allocator_, Column_>::iterator, typename squarelist<T_, Compare_, Allocator_, Column_>::iterator> squarelist<T_, Compare_, Allocator_, Column_>::equal_range(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x){
+		return std::make_pair(lower_bound(x), upper_bound(x));
+}
+/*		@fn:        std::pair<const_iterator, const_iterator> equal_range(const_reference x) const;
+*		@brief:		Finds the range of values in the square list that are equal to X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	pair of const_iterators, the lower_bound and upper_bound of X
+*		@pre:		None.
+*		@post:		The range is returned to the client, it is empty if X is not in the square list*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+std::pair<typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator, typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator> squarelist<T_, Compare_, Allocator_, Column_>::equal_range(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		return std::make_pair(lower_bound(x), upper_bound(x));
+}
+/*		@fn:        iterator find(const_reference x);
+*		@brief:		Finds a value equal to X in the square list
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	iterator to the first value equal to X, or end() if there is none
+*		@pre:		None.
+*		@post:		An iterator is returned to the client*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::iterator squarelist<T_, Compare_, Allocator_, Column_>::find(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x){
+		iterator pos = lower_bound(x);
+		if(pos == this->end() || this->comp_(x, *pos))
+				return this->end();
+		return pos;
+}
+/*		@fn:        const_iterator find(const_reference x) const;
+*		@brief:		Finds a value equal to X in the square list
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	const_iterator to the first value equal to X, or end() if there is none
+*		@pre:		None.
+*		@post:		A const_iterator is returned to the client*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::const_iterator squarelist<T_, Compare_, Allocator_, Column_>::find(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		const_iterator pos = lower_bound(x);
+		if(pos == this->cend() || this->comp_(x, *pos))
+				return this->cend();
+		return pos;
+}
+/*		@fn:        bool contains(const_reference x) const;
+*		@brief:		Checks if a value equal to X is in the square list
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	bool indicating if X was found
+*		@pre:		None.
+*		@post:		whether or not X is in the square list*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist<T_, Compare_, Allocator_, Column_>::contains(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		return find(x) != this->cend();
+}
+/*		@fn:        size_type count(const_reference x) const;
+*		@brief:		Counts the values equal to X in the square list
+*		@pram:		const_reference x [in] value to be counted
+*		@return:	size_type number of values equal to X
+*		@pre:		None.
+*		@post:		the number of values equal to X is returned to the client*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist<T_, Compare_, Allocator_, Column_>::size_type squarelist<T_, Compare_, Allocator_, Column_>::count(typename squarelist<T_, Compare_, Allocator_, Column_>::const_reference x) const{
+		std::pair<const_iterator, const_iterator> range = equal_range(x);
+		return std::distance(range.first, range.second);
+}
 #if defined(_DEBUG)
 /*		@fn:        bool is_sorted()
 *		@brief:		determines if the square list is sorted
@@ -600,14 +1640,14 @@ typename squarelist<T_>::iterator squarelist<T_>::erase(typename squarelist<T_>:
 *		@return:	int for determining if the square list is sorted
 *		@pre:		A squarelist object must be created and the compiler must be in debug mode
 *		@post:		verifies with a 0 if the square list is sorted*/
-template<typename T_>
-bool squarelist<T_>::is_sorted(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist<T_, Compare_, Allocator_, Column_>::is_sorted(){
 		if(squarelist_->size() == 1 && squarelist_->front()->size() == 0) return true;
 		for(auto iter = squarelist_->cbegin(); iter != this->squarelist_->cend(); iter++){
 				auto lhs = (*iter)->cbegin();
 			
 				for(auto rhs = ++(*iter)->cbegin(); rhs != (*iter)->cend();rhs++){
-						if((*lhs++) > (*rhs))
+						if(this->comp_(*rhs, *lhs++))
 								return false;
 				}	
 		}
@@ -619,11 +1659,11 @@ bool squarelist<T_>::is_sorted(){
 *		@return:	int for determining if the square list is squared
 *		@pre:		A squarelist object must be created and the compiler must be in debug mode
 *		@post:		verifies with a 0 if the square list is squared*/
-template<typename T_>
-bool squarelist<T_>::is_square(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist<T_, Compare_, Allocator_, Column_>::is_square(){
 		if(squarelist_->size() == 1 && squarelist_->front()->size() == 0) return true;
 		
-		std::size_t maxDepth = static_cast<int>(std::ceil(std::sqrt( size_ * 1.0 )));
+		std::size_t maxDepth = this->maxDepth();
 
 		if( this->squarelist_->size() > maxDepth)
 				return false;
@@ -641,8 +1681,8 @@ bool squarelist<T_>::is_square(){
 *		@return:	void
 *		@pre:		None.
 *		@post:		File is created with the squarelist contents*/
-template<typename T_>
-void squarelist<T_>::print(std::string fileName){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+void squarelist<T_, Compare_, Allocator_, Column_>::print(std::string fileName){
 	std::stringstream ss;
 	ss << "Elements:\t" << size_ << "\n";
 	ss << "MaxDepth:\t" << static_cast<int>(std::ceil(std::sqrt( size_ * 1.0 ))) << "\n\n\n";
@@ -677,28 +1717,39 @@ void squarelist<T_>::print(std::string fileName){
 	}catch(...){}
 }
 
-template<typename T_>
-class squarelist_iterator : public std::iterator<std::bidirectional_iterator_tag, T_, std::ptrdiff_t, const T_ *, const T_ &>{
-		friend class squarelist<T_>;
-		friend class const_squarelist_iterator<T_>;
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+class squarelist_iterator : public std::iterator<std::random_access_iterator_tag, T_, std::ptrdiff_t, const T_ *, const T_ &>{
+		friend class squarelist<T_, Compare_, Allocator_, Column_>;
+		friend class const_squarelist_iterator<T_, Compare_, Allocator_, Column_>;
 public:
-		squarelist_iterator(typename squarelist<value_type>::outter_list::iterator outter, typename squarelist<value_type>::outter_list::iterator outterStop, typename squarelist<value_type>::list::iterator inner):head_(outter), headStop_(outterStop), elem_(inner){}
-		squarelist_iterator(squarelist_iterator<value_type> const& slistIter) :head_(slistIter.head_), headStop_(slistIter.headStop_), elem_(slistIter.elem_){}
+		squarelist_iterator(typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::iterator outter, typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::iterator outterStop, typename squarelist<T_, Compare_, Allocator_, Column_>::list::iterator inner):head_(outter), headStop_(outterStop), elem_(inner){}
+		squarelist_iterator(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& slistIter) :head_(slistIter.head_), headStop_(slistIter.headStop_), elem_(slistIter.elem_){}
 		squarelist_iterator(){}
 		~squarelist_iterator(){}
 		const reference operator*() const;
-		const squarelist_iterator<T_>& operator++();
-		const squarelist_iterator<T_> operator++(int); 
-		const squarelist_iterator<T_>& operator--();
-		const squarelist_iterator<T_> operator--(int);
+		const squarelist_iterator<T_, Compare_, Allocator_, Column_>& operator++();
+		const squarelist_iterator<T_, Compare_, Allocator_, Column_> operator++(int); 
+		const squarelist_iterator<T_, Compare_, Allocator_, Column_>& operator--();
+		const squarelist_iterator<T_, Compare_, Allocator_, Column_> operator--(int);
 
 		squarelist_iterator& operator=(squarelist_iterator const& lhs);
-		bool operator==(squarelist_iterator<T_> const& rhs) const;
-		bool operator!=(squarelist_iterator<T_> const& rhs) const;
+		bool operator==(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		bool operator!=(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		squarelist_iterator<T_, Compare_, Allocator_, Column_>& operator+=(difference_type n);
+		squarelist_iterator<T_, Compare_, Allocator_, Column_>& operator-=(difference_type n);
+		squarelist_iterator<T_, Compare_, Allocator_, Column_> operator+(difference_type n) const;
+		squarelist_iterator<T_, Compare_, Allocator_, Column_> operator-(difference_type n) const;
+		difference_type operator-(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		const reference operator[](difference_type n) const;
+		bool operator<(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		bool operator>(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		bool operator<=(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		bool operator>=(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
 private:
-		typename squarelist<value_type>::outter_list::iterator head_;
-		typename squarelist<value_type>::outter_list::iterator headStop_;
-		typename squarelist<value_type>::list::iterator elem_;
+		difference_type remaining() const;
+		typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::iterator head_;
+		typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::iterator headStop_;
+		typename squarelist<T_, Compare_, Allocator_, Column_>::list::iterator elem_;
 };
 /*		@fn:        const reference operator*() const;
 *		@brief:		Returns a constant reference to the value type
@@ -706,8 +1757,8 @@ private:
 *		@return:	a constant reference to the value type
 *		@pre:		Parameter object must have been constructed using the three arg constructor
 *		@post:		Returns a constant reference to the value type*/
-template<typename T_>
-typename const squarelist_iterator<T_>::reference squarelist_iterator<T_>::operator*() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename const squarelist_iterator<T_, Compare_, Allocator_, Column_>::reference squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator*() const{
 		return (*this->elem_);
 }
 /*		@fn:        bool operator==(squarelist_iterator<T_> const& rhs) const
@@ -716,8 +1767,8 @@ typename const squarelist_iterator<T_>::reference squarelist_iterator<T_>::opera
 *		@return:		bool indicating if they are the same
 *		@pre:		Parameter object must have been constructed using the three arg constructor
 *		@post:		bool indicating if they are the same*/
-template<typename T_>
-bool squarelist_iterator<T_>::operator==(typename squarelist_iterator<T_> const& rhs) const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator==(typename squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
 	return this->head_ == rhs.head_ && this->elem_ == rhs.elem_;
 }
 /*		@fn:        bool operator!=(squarelist_iterator<T_> const& rhs) const
@@ -726,8 +1777,8 @@ bool squarelist_iterator<T_>::operator==(typename squarelist_iterator<T_> const&
 *		@return:		bool indicating if they are different
 *		@pre:		Parameter object must have been constructed using the three arg constructor
 *		@post:		bool indicating if they are different*/
-template<typename T_>
-bool squarelist_iterator<T_>::operator!=(typename squarelist_iterator<T_> const& rhs) const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator!=(typename squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
 	return !(*this == rhs);
 }
 /*		@fn:        const squarelist_iterator<T_> operator++(); 
@@ -736,8 +1787,8 @@ bool squarelist_iterator<T_>::operator!=(typename squarelist_iterator<T_> const&
 *		@return:		squarelist_iterator<T_> of the incremented iterator.
 *		@pre:		There must be a next element in the connected aggregate.
 *		@post:		object is incremented*/
-template<typename T_>
-const squarelist_iterator<T_>& squarelist_iterator<T_>::operator++(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const squarelist_iterator<T_, Compare_, Allocator_, Column_>& squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator++(){
 		assert(!(head_ == headStop_));		
 		++elem_;
 		if(elem_ == (*head_)->end()){
@@ -753,9 +1804,9 @@ const squarelist_iterator<T_>& squarelist_iterator<T_>::operator++(){
 *		@return:		squarelist_iterator<T_>  of the previous iterator object.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is incremented*/
-template<typename T_>
-const squarelist_iterator<T_> squarelist_iterator<T_>::operator++(int){
-		squarelist_iterator<T_> temp = *this;
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const squarelist_iterator<T_, Compare_, Allocator_, Column_> squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator++(int){
+		squarelist_iterator<T_, Compare_, Allocator_, Column_> temp = *this;
 		++*this;
 		return temp;
 }	
@@ -765,8 +1816,8 @@ const squarelist_iterator<T_> squarelist_iterator<T_>::operator++(int){
 *		@return:		squarelist_iterator<T_>  of the decremented iterator.
 *		@pre:		There must be a previous element in the connecting aggregate.
 *		@post:		object is decremented*/
-template<typename T_>
-const squarelist_iterator<T_>& squarelist_iterator<T_>::operator--(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const squarelist_iterator<T_, Compare_, Allocator_, Column_>& squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator--(){
 		if(head_ == headStop_){
 			--head_;
 		    elem_ = --(*head_)->end();
@@ -784,9 +1835,9 @@ const squarelist_iterator<T_>& squarelist_iterator<T_>::operator--(){
 *		@return:		squarelist_iterator<T_>  of the previous iterator object.
 *		@pre:		There must be a previous element in the connecting aggregate.
 *		@post:		object is decremented*/
-template<typename T_>
-const squarelist_iterator<T_> squarelist_iterator<T_>::operator--(int){
-		squarelist_iterator<T_> temp = *this;
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const squarelist_iterator<T_, Compare_, Allocator_, Column_> squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator--(int){
+		squarelist_iterator<T_, Compare_, Allocator_, Column_> temp = *this;
 		--*this;
 		return temp;
 }
@@ -796,35 +1847,218 @@ const squarelist_iterator<T_> squarelist_iterator<T_>::operator--(int){
 *		@return:		squarelist_iterator<T_>  of the newly assigned object
 *		@pre:		The parameter's object must be created.
 *		@post:		The current squarelist_iterator<T_> object contains the values of the parameter */
-template<typename T_>
-inline typename squarelist_iterator<T_>& squarelist_iterator<T_>::operator=(typename  squarelist_iterator<T_> const& lhs){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+inline typename squarelist_iterator<T_, Compare_, Allocator_, Column_>& squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator=(typename  squarelist_iterator<T_, Compare_, Allocator_, Column_> const& lhs){
 		this->head_ = lhs.head_;
 		this->headStop_ = lhs.headStop_;
 		this->elem_ = lhs.elem_;
 		return *this;
 }
-template<typename T_>
-class const_squarelist_iterator : public std::iterator<std::bidirectional_iterator_tag, T_, ptrdiff_t,  const T_*,  const T_&>{
-		friend class squarelist<T_>;
+/*		@fn:        squarelist_iterator<T_>& operator+=(difference_type n);
+*		@brief:		Moves the squarelist_iterator object N values forward
+*		@pram:		difference_type n [in] number of values to move, negative moves backward
+*		@return:		squarelist_iterator<T_>& of the moved iterator.
+*		@pre:		There must be N values after the iterator in the connected aggregate.
+*		@post:		object is moved, whole vertical lists are skipped by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+squarelist_iterator<T_, Compare_, Allocator_, Column_>& squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator+=(typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n){
+		if(n < 0)
+				return *this -= -n;
+		if(n == 0)
+				return *this;
+		assert(!(head_ == headStop_));
+		difference_type left = std::distance(elem_, (*head_)->end());
+		if(n < left){
+				std::advance(elem_, n);
+				return *this;
+		}
+		n -= left;
+		auto last = head_++;
+		while(head_ != headStop_ && n >= static_cast<difference_type>((*head_)->size())){
+				n -= (*head_)->size();
+				last = head_++;
+		}
+		if(head_ == headStop_){
+				assert(n == 0);
+				elem_ = (*last)->end();
+		} else {
+				elem_ = (*head_)->begin();
+				std::advance(elem_, n);
+		}
+		return *this;
+}
+/*		@fn:        squarelist_iterator<T_>& operator-=(difference_type n);
+*		@brief:		Moves the squarelist_iterator object N values backward
+*		@pram:		difference_type n [in] number of values to move, negative moves forward
+*		@return:		squarelist_iterator<T_>& of the moved iterator.
+*		@pre:		There must be N values before the iterator in the connected aggregate.
+*		@post:		object is moved, whole vertical lists are skipped by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+squarelist_iterator<T_, Compare_, Allocator_, Column_>& squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator-=(typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n){
+		if(n < 0)
+				return *this += -n;
+		if(n == 0)
+				return *this;
+		if(head_ == headStop_){
+				--head_;
+				elem_ = (*head_)->end();
+		}
+		difference_type before = std::distance((*head_)->begin(), elem_);
+		if(n <= before){
+				std::advance(elem_, -n);
+				return *this;
+		}
+		n -= before;
+		--head_;
+		while(n > static_cast<difference_type>((*head_)->size())){
+				n -= (*head_)->size();
+				--head_;
+		}
+		elem_ = (*head_)->end();
+		std::advance(elem_, -n);
+		return *this;
+}
+/*		@fn:        squarelist_iterator<T_> operator+(difference_type n) const;
+*		@brief:		Gets the squarelist_iterator N values forward of this one
+*		@pram:		difference_type n [in] number of values to move
+*		@return:		squarelist_iterator<T_> of the moved iterator.
+*		@pre:		There must be N values after the iterator in the connected aggregate.
+*		@post:		this object is unchanged*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+squarelist_iterator<T_, Compare_, Allocator_, Column_> squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator+(typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n) const{
+		squarelist_iterator<T_, Compare_, Allocator_, Column_> temp = *this;
+		return temp += n;
+}
+/*		@fn:        squarelist_iterator<T_> operator-(difference_type n) const;
+*		@brief:		Gets the squarelist_iterator N values backward of this one
+*		@pram:		difference_type n [in] number of values to move
+*		@return:		squarelist_iterator<T_> of the moved iterator.
+*		@pre:		There must be N values before the iterator in the connected aggregate.
+*		@post:		this object is unchanged*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+squarelist_iterator<T_, Compare_, Allocator_, Column_> squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator-(typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n) const{
+		squarelist_iterator<T_, Compare_, Allocator_, Column_> temp = *this;
+		return temp -= n;
+}
+/*		@fn:        squarelist_iterator<T_> operator+(difference_type n, squarelist_iterator<T_> const& x);
+*		@brief:		Gets the squarelist_iterator N values forward of X
+*		@pram:		difference_type n [in] number of values to move
+*						squarelist_iterator<T_> const& x [in] iterator to move from
+*		@return:		squarelist_iterator<T_> of the moved iterator.
+*		@pre:		There must be N values after X in the connected aggregate.
+*		@post:		X is unchanged*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+squarelist_iterator<T_, Compare_, Allocator_, Column_> operator+(typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n, squarelist_iterator<T_, Compare_, Allocator_, Column_> const& x){
+		return x + n;
+}
+/*		@fn:        difference_type operator-(squarelist_iterator<T_> const& rhs) const;
+*		@brief:		Counts the values between rhs and this object
+*		@pram:		squarelist_iterator<T_> const& rhs [in] iterator to count from
+*		@return:		difference_type number of values from rhs to this object, negative if rhs is after it
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		the distance is returned, whole vertical lists are counted by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator-(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return rhs.remaining() - this->remaining();
+}
+/*		@fn:        const reference operator[](difference_type n) const;
+*		@brief:		Returns a constant reference to the value N values forward of this one
+*		@pram:		difference_type n [in] number of values to move
+*		@return:		a constant reference to the value type
+*		@pre:		There must be more than N values after the iterator in the connected aggregate.
+*		@post:		this object is unchanged*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::reference squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator[](typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n) const{
+		return *(*this + n);
+}
+/*		@fn:        bool operator<(squarelist_iterator<T_> const& rhs) const
+*		@brief:		Checks if this object comes before rhs
+*		@pram:		squarelist_iterator<T_> const& rhs [in] object to compare against
+*		@return:		bool indicating if this object comes first
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		bool indicating if this object comes first*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator<(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return this->remaining() > rhs.remaining();
+}
+/*		@fn:        bool operator>(squarelist_iterator<T_> const& rhs) const
+*		@brief:		Checks if this object comes after rhs
+*		@pram:		squarelist_iterator<T_> const& rhs [in] object to compare against
+*		@return:		bool indicating if this object comes last
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		bool indicating if this object comes last*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator>(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return rhs < *this;
+}
+/*		@fn:        bool operator<=(squarelist_iterator<T_> const& rhs) const
+*		@brief:		Checks if this object does not come after rhs
+*		@pram:		squarelist_iterator<T_> const& rhs [in] object to compare against
+*		@return:		bool indicating if this object does not come last
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		bool indicating if this object does not come last*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator<=(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return !(rhs < *this);
+}
+/*		@fn:        bool operator>=(squarelist_iterator<T_> const& rhs) const
+*		@brief:		Checks if this object does not come before rhs
+*		@pram:		squarelist_iterator<T_> const& rhs [in] object to compare against
+*		@return:		bool indicating if this object does not come first
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		bool indicating if this object does not come first*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator>=(squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return !(*this < rhs);
+}
+/*		@fn:        difference_type remaining() const;
+*		@brief:		Counts the values from this object to the end of the connected aggregate
+*		@pram:		None
+*		@return:		difference_type number of values left
+*		@pre:		Parameter object must have been constructed using the three arg constructor
+*		@post:		the count is returned, whole vertical lists are counted by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type squarelist_iterator<T_, Compare_, Allocator_, Column_>::remaining() const{
+		if(head_ == headStop_)
+				return 0;
+		difference_type count = std::distance(elem_, (*head_)->end());
+		for(auto iter = std::next(head_); iter != headStop_; ++iter)
+				count += (*iter)->size();
+		return count;
+}
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+class const_squarelist_iterator : public std::iterator<std::random_access_iterator_tag, T_, ptrdiff_t,  const T_*,  const T_&>{
+		friend class squarelist<T_, Compare_, Allocator_, Column_>;
 public:
-		const_squarelist_iterator(typename squarelist<value_type>::outter_list::const_iterator outter, typename squarelist<value_type>::outter_list::const_iterator outterStop, typename squarelist<value_type>::list::const_iterator inner):head_(outter), headStop_(outterStop), elem_(inner){}
-		const_squarelist_iterator(const_squarelist_iterator<value_type> const& slistIter) :head_(slistIter.head_), headStop_(slistIter.headStop_), elem_(slistIter.elem_){}
-		const_squarelist_iterator( squarelist_iterator<value_type> const& slistIter) :head_(slistIter.head_), headStop_(slistIter.headStop_), elem_(slistIter.elem_){}
+		const_squarelist_iterator(typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::const_iterator outter, typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::const_iterator outterStop, typename squarelist<T_, Compare_, Allocator_, Column_>::list::const_iterator inner):head_(outter), headStop_(outterStop), elem_(inner){}
+		const_squarelist_iterator(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& slistIter) :head_(slistIter.head_), headStop_(slistIter.headStop_), elem_(slistIter.elem_){}
+		const_squarelist_iterator( squarelist_iterator<T_, Compare_, Allocator_, Column_> const& slistIter) :head_(slistIter.head_), headStop_(slistIter.headStop_), elem_(slistIter.elem_){}
 		const_squarelist_iterator(){}
 		~const_squarelist_iterator(){}
 		const reference operator*() const;
-		const const_squarelist_iterator<T_>& operator++();
-		const const_squarelist_iterator<T_> operator++(int); 
-		const const_squarelist_iterator<T_>& operator--();
-		const const_squarelist_iterator<T_> operator--(int);
+		const const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& operator++();
+		const const_squarelist_iterator<T_, Compare_, Allocator_, Column_> operator++(int); 
+		const const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& operator--();
+		const const_squarelist_iterator<T_, Compare_, Allocator_, Column_> operator--(int);
 
 		const_squarelist_iterator& operator=(const_squarelist_iterator const& lhs);
-		bool operator==(const_squarelist_iterator<T_> const& rhs) const;
-		bool operator!=(const_squarelist_iterator<T_> const& rhs) const;
+		bool operator==(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		bool operator!=(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& operator+=(difference_type n);
+		const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& operator-=(difference_type n);
+		const_squarelist_iterator<T_, Compare_, Allocator_, Column_> operator+(difference_type n) const;
+		const_squarelist_iterator<T_, Compare_, Allocator_, Column_> operator-(difference_type n) const;
+		difference_type operator-(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		const reference operator[](difference_type n) const;
+		bool operator<(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		bool operator>(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		bool operator<=(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
+		bool operator>=(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const;
 private:
-		typename squarelist<value_type>::outter_list::const_iterator head_;
-		typename squarelist<value_type>::outter_list::const_iterator headStop_;
-		typename squarelist<value_type>::list::const_iterator elem_;
+		difference_type remaining() const;
+		typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::const_iterator head_;
+		typename squarelist<T_, Compare_, Allocator_, Column_>::outter_list::const_iterator headStop_;
+		typename squarelist<T_, Compare_, Allocator_, Column_>::list::const_iterator elem_;
 };
 /*		@fn:        const reference operator*() const;
 *		@brief:		Returns a constant reference to the value type
@@ -832,8 +2066,8 @@ private:
 *		@return:		a constant reference to the value type
 *		@pre:		Parameter object must have been constructed using the three arg constructor
 *		@post:		Returns a constant reference to the value type*/
-template<typename T_>
-typename const const_squarelist_iterator<T_>::reference const_squarelist_iterator<T_>::operator*() const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename const const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::reference const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator*() const{
 		return (*this->elem_);
 }
 /*		@fn:        bool operator==(const_squarelist_iterator<T_> const& rhs) const
@@ -842,8 +2076,8 @@ typename const const_squarelist_iterator<T_>::reference const_squarelist_iterato
 *		@return:		bool indicating if they are the same
 *		@pre:		Parameter object must have been constructed using the three arg constructor
 *		@post:		bool indicating if they are the same*/
-template<typename T_>
-bool const_squarelist_iterator<T_>::operator==(typename const_squarelist_iterator<T_> const& rhs) const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator==(typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
 	return this->head_ == rhs.head_ && this->elem_ == rhs.elem_;
 }
 /*		@fn:        bool operator!=(const_squarelist_iterator<T_> const& rhs) const
@@ -852,8 +2086,8 @@ bool const_squarelist_iterator<T_>::operator==(typename const_squarelist_iterato
 *		@return:		bool indicating if they are different
 *		@pre:		Parameter object must have been constructed using the three arg constructor
 *		@post:		bool indicating if they are different*/
-template<typename T_>
-bool const_squarelist_iterator<T_>::operator!=(typename const_squarelist_iterator<T_> const& rhs) const{
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator!=(typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
 	return !(*this == rhs);
 }
 /*		@fn:        const const_squarelist_iterator<T_> operator++(); 
@@ -862,8 +2096,8 @@ bool const_squarelist_iterator<T_>::operator!=(typename const_squarelist_iterato
 *		@return:		const_squarelist_iterator<T_> of the incremented iterator.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is incremented*/
-template<typename T_>
-const const_squarelist_iterator<T_>& const_squarelist_iterator<T_>::operator++(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator++(){
 		assert(!(head_ == headStop_));
 		++elem_;
 		if(elem_ == (*head_)->end()){
@@ -879,9 +2113,9 @@ const const_squarelist_iterator<T_>& const_squarelist_iterator<T_>::operator++()
 *		@return:		const_squarelist_iterator<T_>  of the previous iterator object.
 *		@pre:		There must be a next element in the connecting aggregate.
 *		@post:		object is incremented*/
-template<typename T_>
-const const_squarelist_iterator<T_> const_squarelist_iterator<T_>::operator++(int){
-		const_squarelist_iterator<T_> temp = *this;
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator++(int){
+		const_squarelist_iterator<T_, Compare_, Allocator_, Column_> temp = *this;
 		++*this;
 		return temp;
 }	
@@ -891,8 +2125,8 @@ const const_squarelist_iterator<T_> const_squarelist_iterator<T_>::operator++(in
 *		@return:		const_squarelist_iterator<T_>  of the decremented iterator.
 *		@pre:		There must be a previous element in the connecting aggregate.
 *		@post:		object is decremented*/
-template<typename T_>
-const const_squarelist_iterator<T_>& const_squarelist_iterator<T_>::operator--(){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator--(){
 		if(head_ == headStop_){
 			--head_;
 		    elem_ = --(*head_)->end();
@@ -910,9 +2144,9 @@ const const_squarelist_iterator<T_>& const_squarelist_iterator<T_>::operator--()
 *		@return:		const_squarelist_iterator<T_>  of the previous iterator object.
 *		@pre:		There must be a previous element in the connecting aggregate.
 *		@post:		object is decremented*/
-template<typename T_>
-const const_squarelist_iterator<T_> const_squarelist_iterator<T_>::operator--(int){
-		const_squarelist_iterator<T_> temp = *this;
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator--(int){
+		const_squarelist_iterator<T_, Compare_, Allocator_, Column_> temp = *this;
 		--*this;
 		return temp;
 }
@@ -922,11 +2156,183 @@ const const_squarelist_iterator<T_> const_squarelist_iterator<T_>::operator--(in
 *		@return:		const_squarelist_iterator<T_>  of the newly assigned object
 *		@pre:		The parameter's object must be created.
 *		@post:		The current const_squarelist_iterator<T_> object contains the values of the parameter */
-template<typename T_>
-inline typename const_squarelist_iterator<T_>& const_squarelist_iterator<T_>::operator=(typename  const_squarelist_iterator<T_> const& lhs){
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+inline typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator=(typename  const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& lhs){
 		this->head_ = lhs.head_;
 		this->headStop_ = lhs.headStop_;
 		this->elem_ = lhs.elem_;
 		return *this;
 }
+/*		@fn:        const_squarelist_iterator<T_>& operator+=(difference_type n);
+*		@brief:		Moves the const_squarelist_iterator object N values forward
+*		@pram:		difference_type n [in] number of values to move, negative moves backward
+*		@return:		const_squarelist_iterator<T_>& of the moved iterator.
+*		@pre:		There must be N values after the iterator in the connected aggregate.
+*		@post:		object is moved, whole vertical lists are skipped by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator+=(typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n){
+		if(n < 0)
+				return *this -= -n;
+		if(n == 0)
+				return *this;
+		assert(!(head_ == headStop_));
+		difference_type left = std::distance(elem_, (*head_)->cend());
+		if(n < left){
+				std::advance(elem_, n);
+				return *this;
+		}
+		n -= left;
+		auto last = head_++;
+		while(head_ != headStop_ && n >= static_cast<difference_type>((*head_)->size())){
+				n -= (*head_)->size();
+				last = head_++;
+		}
+		if(head_ == headStop_){
+				assert(n == 0);
+				elem_ = (*last)->cend();
+		} else {
+				elem_ = (*head_)->cbegin();
+				std::advance(elem_, n);
+		}
+		return *this;
+}
+/*		@fn:        const_squarelist_iterator<T_>& operator-=(difference_type n);
+*		@brief:		Moves the const_squarelist_iterator object N values backward
+*		@pram:		difference_type n [in] number of values to move, negative moves forward
+*		@return:		const_squarelist_iterator<T_>& of the moved iterator.
+*		@pre:		There must be N values before the iterator in the connected aggregate.
+*		@post:		object is moved, whole vertical lists are skipped by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const_squarelist_iterator<T_, Compare_, Allocator_, Column_>& const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator-=(typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n){
+		if(n < 0)
+				return *this += -n;
+		if(n == 0)
+				return *this;
+		if(head_ == headStop_){
+				--head_;
+				elem_ = (*head_)->cend();
+		}
+		difference_type before = std::distance((*head_)->cbegin(), elem_);
+		if(n <= before){
+				std::advance(elem_, -n);
+				return *this;
+		}
+		n -= before;
+		--head_;
+		while(n > static_cast<difference_type>((*head_)->size())){
+				n -= (*head_)->size();
+				--head_;
+		}
+		elem_ = (*head_)->cend();
+		std::advance(elem_, -n);
+		return *this;
+}
+/*		@fn:        const_squarelist_iterator<T_> operator+(difference_type n) const;
+*		@brief:		Gets the const_squarelist_iterator N values forward of this one
+*		@pram:		difference_type n [in] number of values to move
+*		@return:		const_squarelist_iterator<T_> of the moved iterator.
+*		@pre:		There must be N values after the iterator in the connected aggregate.
+*		@post:		this object is unchanged*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator+(typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n) const{
+		const_squarelist_iterator<T_, Compare_, Allocator_, Column_> temp = *this;
+		return temp += n;
+}
+/*		@fn:        const_squarelist_iterator<T_> operator-(difference_type n) const;
+*		@brief:		Gets the const_squarelist_iterator N values backward of this one
+*		@pram:		difference_type n [in] number of values to move
+*		@return:		const_squarelist_iterator<T_> of the moved iterator.
+*		@pre:		There must be N values before the iterator in the connected aggregate.
+*		@post:		this object is unchanged*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator-(typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n) const{
+		const_squarelist_iterator<T_, Compare_, Allocator_, Column_> temp = *this;
+		return temp -= n;
+}
+/*		@fn:        const_squarelist_iterator<T_> operator+(difference_type n, const_squarelist_iterator<T_> const& x);
+*		@brief:		Gets the const_squarelist_iterator N values forward of X
+*		@pram:		difference_type n [in] number of values to move
+*						const_squarelist_iterator<T_> const& x [in] iterator to move from
+*		@return:		const_squarelist_iterator<T_> of the moved iterator.
+*		@pre:		There must be N values after X in the connected aggregate.
+*		@post:		X is unchanged*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+const_squarelist_iterator<T_, Compare_, Allocator_, Column_> operator+(typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n, const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& x){
+		return x + n;
+}
+/*		@fn:        difference_type operator-(const_squarelist_iterator<T_> const& rhs) const;
+*		@brief:		Counts the values between rhs and this object
+*		@pram:		const_squarelist_iterator<T_> const& rhs [in] iterator to count from
+*		@return:		difference_type number of values from rhs to this object, negative if rhs is after it
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		the distance is returned, whole vertical lists are counted by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator-(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return rhs.remaining() - this->remaining();
+}
+/*		@fn:        const reference operator[](difference_type n) const;
+*		@brief:		Returns a constant reference to the value N values forward of this one
+*		@pram:		difference_type n [in] number of values to move
+*		@return:		a constant reference to the value type
+*		@pre:		There must be more than N values after the iterator in the connected aggregate.
+*		@post:		this object is unchanged*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::reference const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator[](typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type n) const{
+		return *(*this + n);
+}
+/*		@fn:        bool operator<(const_squarelist_iterator<T_> const& rhs) const
+*		@brief:		Checks if this object comes before rhs
+*		@pram:		const_squarelist_iterator<T_> const& rhs [in] object to compare against
+*		@return:		bool indicating if this object comes first
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		bool indicating if this object comes first*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator<(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return this->remaining() > rhs.remaining();
+}
+/*		@fn:        bool operator>(const_squarelist_iterator<T_> const& rhs) const
+*		@brief:		Checks if this object comes after rhs
+*		@pram:		const_squarelist_iterator<T_> const& rhs [in] object to compare against
+*		@return:		bool indicating if this object comes last
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		bool indicating if this object comes last*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator>(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return rhs < *this;
+}
+/*		@fn:        bool operator<=(const_squarelist_iterator<T_> const& rhs) const
+*		@brief:		Checks if this object does not come after rhs
+*		@pram:		const_squarelist_iterator<T_> const& rhs [in] object to compare against
+*		@return:		bool indicating if this object does not come last
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		bool indicating if this object does not come last*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator<=(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return !(rhs < *this);
+}
+/*		@fn:        bool operator>=(const_squarelist_iterator<T_> const& rhs) const
+*		@brief:		Checks if this object does not come before rhs
+*		@pram:		const_squarelist_iterator<T_> const& rhs [in] object to compare against
+*		@return:		bool indicating if this object does not come first
+*		@pre:		Both iterators must belong to the same connected aggregate
+*		@post:		bool indicating if this object does not come first*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+bool const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::operator>=(const_squarelist_iterator<T_, Compare_, Allocator_, Column_> const& rhs) const{
+		return !(*this < rhs);
+}
+/*		@fn:        difference_type remaining() const;
+*		@brief:		Counts the values from this object to the end of the connected aggregate
+*		@pram:		None
+*		@return:		difference_type number of values left
+*		@pre:		Parameter object must have been constructed using the three arg constructor
+*		@post:		the count is returned, whole vertical lists are counted by their size*/
+template<typename T_, typename Compare_, typename Allocator_, typename Column_>
+typename const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::difference_type const_squarelist_iterator<T_, Compare_, Allocator_, Column_>::remaining() const{
+		if(head_ == headStop_)
+				return 0;
+		difference_type count = std::distance(elem_, (*head_)->cend());
+		for(auto iter = std::next(head_); iter != headStop_; ++iter)
+				count += (*iter)->size();
+		return count;
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,607 @@
+#if !defined(GUARD_UNROLLED_DLIST_HPP)
+#define GUARD_UNROLLED_DLIST_HPP
+
+/** @file: unrolled_dlist.hpp
+@author Robbie Brandrick
+@author r_brandrick@fanshaweonline.ca
+@date 2012-02-24
+@version 0.1.0
+@note Targets Visual C++ 10.0
+@briefs Unrolled Doubly Linkedlist.
+		unrolled_dlist class declaration and implementation.
+		unrolled_dlist iterator declarations and implementation
+		unrolled_dlist constant iterator declarations and implementation
+		Every node holds as many values as fit in a cache line, so a scan follows one link per line
+		of values where a dlist follows one link per value.
+@invariant unrolled_dlist always contains the head node, no node other than the head is empty*/
+
+#include <iterator>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <memory>
+#include <new>
+#include <type_traits>
+//Forward Declaration
+template<typename T_, typename Allocator_ = std::allocator<T_>> class unrolled_dlist;
+template<typename T_, typename Allocator_ = std::allocator<T_>> class unrolled_dlist_iterator;
+template<typename T_, typename Allocator_ = std::allocator<T_>> class const_unrolled_dlist_iterator;
+
+template<typename T_>
+struct unrolled_dlist_node{
+	typedef std::uint32_t	count_type;
+	//as many values as fit in a cache line beside the links and the count, but at least one
+	enum { cache_line = 64,
+		room = cache_line - 2 * sizeof(void*) - sizeof(count_type),
+		capacity = room / sizeof(T_) > 0 ? room / sizeof(T_) : 1 };
+
+	unrolled_dlist_node* next_;
+	unrolled_dlist_node* prev_;
+	count_type count_;
+	typename std::aligned_storage<sizeof(T_) * capacity, alignof(T_)>::type elems_;
+
+	T_* values(){return reinterpret_cast<T_*>(&elems_);}
+	T_ const* values() const{return reinterpret_cast<T_ const*>(&elems_);}
+};
+
+template<typename T_, typename Allocator_>
+class unrolled_dlist{
+	//Allow The Following class to access unrolled_dlist private members
+	template<typename U_, typename A_> friend class unrolled_dlist_iterator;
+	template<typename U_, typename A_> friend class const_unrolled_dlist_iterator;
+public:
+	typedef std::size_t			size_type;
+	typedef std::ptrdiff_t		difference_type;
+	typedef T_					value_type;
+	typedef T_&					reference_type;
+	typedef T_ const&			const_reference_type;
+	typedef Allocator_			allocator_type;
+	typedef unrolled_dlist_node<T_>				node_type;
+	typedef typename node_type::count_type		count_type;
+	typedef unrolled_dlist_iterator<T_, Allocator_>			iterator;
+	typedef const_unrolled_dlist_iterator<T_, Allocator_>	const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	enum { node_capacity = node_type::capacity };
+
+	unrolled_dlist();
+	explicit unrolled_dlist(allocator_type const& alloc);
+	unrolled_dlist(unrolled_dlist<T_, Allocator_> const& rhs);
+	unrolled_dlist(unrolled_dlist<T_, Allocator_> && rhs);
+	unrolled_dlist& operator=(unrolled_dlist<T_, Allocator_> const& rhs);
+	unrolled_dlist& operator=(unrolled_dlist<T_, Allocator_> && rhs);
+	~unrolled_dlist();
+
+	allocator_type get_allocator() const{return allocator_type(alloc_);}
+
+	iterator begin(){return iterator(head_->next_, 0, this);}
+	const_iterator begin()const{return const_iterator(head_->next_, 0, this);}
+	const_iterator cbegin() const{return const_iterator(head_->next_, 0, this);}
+
+	reverse_iterator rbegin(){return reverse_iterator(end());}
+	const_reverse_iterator rbegin()const{return const_reverse_iterator(cend());}
+	const_reverse_iterator crbegin()const{return const_reverse_iterator(cend());}
+
+	iterator end(){return iterator(head_, 0, this);}
+	const_iterator end() const{return const_iterator(head_, 0, this);}
+	const_iterator cend() const{return const_iterator(head_, 0, this);}
+
+	reverse_iterator rend(){return reverse_iterator(begin());}
+	const_reverse_iterator rend()const{return const_reverse_iterator(cbegin());}
+	const_reverse_iterator crend()const{return const_reverse_iterator(cbegin());}
+
+	reference_type front(){assert(!(size_ == 0)); return head_->next_->values()[0];}
+	const_reference_type front() const{assert(!(size_ == 0)); return head_->next_->values()[0];}
+	reference_type back(){assert(!(size_ == 0)); return head_->prev_->values()[head_->prev_->count_ - 1];}
+	const_reference_type back() const{assert(!(size_ == 0)); return head_->prev_->values()[head_->prev_->count_ - 1];}
+	size_type size() const{return size_;}
+	bool empty() const{return size_ == 0;}
+	void clear();
+
+	void push_back(const_reference_type value){emplace(end(), value);}
+	void push_back(value_type&& value){emplace(end(), std::move(value));}
+	void push_front(const_reference_type value){emplace(begin(), value);}
+	void push_front(value_type&& value){emplace(begin(), std::move(value));}
+	template<typename... Args>
+	void emplace_back(Args&&... args){emplace(end(), std::forward<Args>(args)...);}
+	template<typename... Args>
+	void emplace_front(Args&&... args){emplace(begin(), std::forward<Args>(args)...);}
+	void pop_back(){erase(--end());}
+	void pop_front(){erase(begin());}
+
+	iterator insert( const iterator position, const_reference_type x){return emplace(position, x);}
+	iterator insert( const iterator position, value_type&& x){return emplace(position, std::move(x));}
+	template<typename... Args>
+	iterator emplace( const iterator position, Args&&... args);
+	iterator erase( const iterator position);
+	void splice( const iterator position, unrolled_dlist<T_, Allocator_>& other);
+	void splice( const iterator position, unrolled_dlist<T_, Allocator_>& other, iterator i);
+	void splice( const iterator position, unrolled_dlist<T_, Allocator_>& other, iterator first, iterator last);
+private:
+	typedef typename std::allocator_traits<Allocator_>::template rebind_alloc<node_type> node_allocator;
+	typedef std::allocator_traits<node_allocator> node_traits;
+
+	node_allocator alloc_;
+	node_type* head_;
+	size_type size_;
+
+	node_type* createNode();
+	void destroyNode(node_type* node);
+	void link(node_type* position, node_type* node);
+	void unlink(node_type* node);
+	node_type* cut(iterator at, iterator& follow);
+	void mergeNext(node_type* node);
+	void dispose();
+};
+/*		@fn:	    unrolled_dlist();
+*		@brief:		default constructor
+*		@pram:		none.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		An unrolled_dlist object will be constructed holding only its head node.*/
+template<typename T_, typename Allocator_>
+unrolled_dlist<T_, Allocator_>::unrolled_dlist() : head_(nullptr), size_(0){
+	head_ = createNode();
+}
+/*		@fn:	    unrolled_dlist(allocator_type const& alloc);
+*		@brief:		allocator constructor
+*		@pram:		allocator_type const& alloc [in] allocator the nodes are taken from.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		An unrolled_dlist object will be constructed holding only its head node.*/
+template<typename T_, typename Allocator_>
+unrolled_dlist<T_, Allocator_>::unrolled_dlist(typename unrolled_dlist<T_, Allocator_>::allocator_type const& alloc) : alloc_(alloc), head_(nullptr), size_(0){
+	head_ = createNode();
+}
+/*		@fn:		unrolled_dlist(unrolled_dlist const& rhs);
+*		@brief:		copy constructor
+*		@pram:		unrolled_dlist const& rhs [in] object to copy.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		The values of rhs are copied in order into full nodes*/
+template<typename T_, typename Allocator_>
+unrolled_dlist<T_, Allocator_>::unrolled_dlist(unrolled_dlist<T_, Allocator_> const& rhs)
+	: alloc_(node_traits::select_on_container_copy_construction(rhs.alloc_)), head_(nullptr), size_(0){
+	head_ = createNode();
+	for(const_iterator iter = rhs.cbegin(); iter != rhs.cend(); ++iter)
+		push_back(*iter);
+}
+/*		@fn:		unrolled_dlist(unrolled_dlist && rhs);
+*		@brief:		move constructor
+*		@pram:		unrolled_dlist && rhs [in] object to move from.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		The nodes of rhs are taken over, rhs is left empty*/
+template<typename T_, typename Allocator_>
+unrolled_dlist<T_, Allocator_>::unrolled_dlist(unrolled_dlist<T_, Allocator_> && rhs) : alloc_(rhs.alloc_), head_(nullptr), size_(0){
+	head_ = createNode();
+	std::swap(this->head_, rhs.head_);
+	std::swap(this->size_, rhs.size_);
+}
+/*		@fn:		unrolled_dlist& operator=(unrolled_dlist const& rhs);
+*		@brief:		copy assignment
+*		@pram:		unrolled_dlist const& rhs [in] object to copy.
+*		@return:	unrolled_dlist&, reference to this.
+*		@pre:		none.
+*		@post:		This list holds copies of the values of rhs*/
+template<typename T_, typename Allocator_>
+unrolled_dlist<T_, Allocator_>& unrolled_dlist<T_, Allocator_>::operator=(unrolled_dlist<T_, Allocator_> const& rhs){
+	if(this != &rhs){
+		unrolled_dlist<T_, Allocator_> copy(rhs);
+		*this = std::move(copy);
+	}
+	return *this;
+}
+/*		@fn:		unrolled_dlist& operator=(unrolled_dlist && rhs);
+*		@brief:		move assignment
+*		@pram:		unrolled_dlist && rhs [in] object to move from.
+*		@return:	unrolled_dlist&, reference to this.
+*		@pre:		none.
+*		@post:		This list owns the nodes of rhs, rhs is left empty*/
+template<typename T_, typename Allocator_>
+unrolled_dlist<T_, Allocator_>& unrolled_dlist<T_, Allocator_>::operator=(unrolled_dlist<T_, Allocator_> && rhs){
+	if(this != &rhs){
+		clear();
+		std::swap(this->alloc_, rhs.alloc_);
+		std::swap(this->head_, rhs.head_);
+		std::swap(this->size_, rhs.size_);
+	}
+	return *this;
+}
+/*		@fn:		~unrolled_dlist();
+*		@brief:		destructs the current object and calls the dispose() method.
+*		@pram:		none.
+*		@return:	none.
+*		@pre:		none.
+*		@post:		object of unrolled_dlist will be destructed*/
+template<typename T_, typename Allocator_>
+unrolled_dlist<T_, Allocator_>::~unrolled_dlist(){
+	dispose();
+}
+/*		@fn:		void clear()
+*		@brief:		Empties all of unrolled_dlist's nodes
+*		@pram:		none.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		Every node but the head is destroyed*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::clear(){
+	while(head_->next_ != head_){
+		node_type* node = head_->next_;
+		unlink(node);
+		destroyNode(node);
+	}
+	size_ = 0;
+}
+/*		@fn:		iterator emplace(iterator position, Args&&... args)
+*		@brief:		The list container is extended by constructing a new element before the element at position.
+*		@pram:		iterator position [in] Position in the container where the new element is constructed.
+*					Args&&... args [in] arguments forwarded to the value's constructor.
+*		@return:	iterator that points to the newly constructed element.
+*		@pre:	    position must belong to this list
+*		@post:		The value goes into the node before position when it has room, a full node is split in half.
+*						Iterators into the node the value went in, and into a split node, are invalidated*/
+template<typename T_, typename Allocator_>
+template< typename... Args>
+typename unrolled_dlist<T_, Allocator_>::iterator unrolled_dlist<T_, Allocator_>::emplace(const typename unrolled_dlist<T_, Allocator_>::iterator position, Args&&... args){
+	assert(!(this != position.list_));
+	//built first, args may refer to a value that is about to be shifted
+	value_type value(std::forward<Args>(args)...);
+	node_type* node = position.node_;
+	count_type index = position.index_;
+	if(index == 0 && node->prev_ != head_ && node->prev_->count_ < node_capacity){
+		node = node->prev_;
+		index = node->count_;
+	} else if(node == head_){
+		node = createNode();
+		link(head_, node);
+		index = 0;
+	} else if(node->count_ == node_capacity){
+		node_type* half = createNode();
+		link(node->next_, half);
+		count_type keep = node_capacity / 2;
+		T_* values = node->values();
+		for(count_type moved = keep; moved < node->count_; ++moved){
+			::new(static_cast<void*>(half->values() + moved - keep)) value_type(std::move(values[moved]));
+			values[moved].~value_type();
+		}
+		half->count_ = node->count_ - keep;
+		node->count_ = keep;
+		if(index > keep){
+			node = half;
+			index -= keep;
+		}
+	}
+
+	T_* values = node->values();
+	if(index == node->count_)
+		::new(static_cast<void*>(values + index)) value_type(std::move(value));
+	else {
+		::new(static_cast<void*>(values + node->count_)) value_type(std::move(values[node->count_ - 1]));
+		std::move_backward(values + index, values + node->count_ - 1, values + node->count_);
+		values[index] = std::move(value);
+	}
+	++node->count_;
+	++size_;
+	return iterator(node, index, this);
+}
+/*		@fn:		iterator erase(iterator position)
+*		@brief:		Removes a single element from the list container
+*		@pram:		iterator position [in] Iterator pointing to the element to be removed.
+*		@return:	iterator pointing to the element that followed the erased one
+*		@pre:	    position must reference a value of this list
+*		@post:		The values after position in its node slide down, an emptied node is destroyed and a node
+*						less than half full is merged with a neighbour when they fit in one node.
+*						Iterators into the touched nodes are invalidated*/
+template<typename T_, typename Allocator_>
+typename unrolled_dlist<T_, Allocator_>::iterator unrolled_dlist<T_, Allocator_>::erase(const typename unrolled_dlist<T_, Allocator_>::iterator position){
+	assert(!(size_ == 0));
+	assert(!(position.node_ == head_));
+	assert(!(this != position.list_));
+	node_type* node = position.node_;
+	count_type index = position.index_;
+	T_* values = node->values();
+	std::move(values + index + 1, values + node->count_, values + index);
+	values[--node->count_].~value_type();
+	--size_;
+
+	if(node->count_ == 0){
+		node_type* next = node->next_;
+		unlink(node);
+		destroyNode(node);
+		return iterator(next, 0, this);
+	}
+	if(node->count_ < node_capacity / 2){
+		node_type* prev = node->prev_;
+		if(prev != head_ && prev->count_ + node->count_ <= node_capacity){
+			index += prev->count_;
+			node = prev;
+		}
+		mergeNext(node);
+	}
+	if(index < node->count_)
+		return iterator(node, index, this);
+	return iterator(node->next_, 0, this);
+}
+/*		@fn:		void splice(iterator position, unrolled_dlist& other)
+*		@brief:		Moves every value of other in front of position
+*		@pram:		iterator position [in] Position in this list the values go in front of.
+*					unrolled_dlist& other [in/out] list giving up its values.
+*		@return:	void.
+*		@pre:	    position must belong to this list
+*		@post:		other is empty, its nodes are relinked when the allocators compare equal*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::splice(const typename unrolled_dlist<T_, Allocator_>::iterator position, unrolled_dlist<T_, Allocator_>& other){
+	if(this == &other || other.size_ == 0)
+		return;
+	splice(position, other, other.begin(), other.end());
+}
+/*		@fn:		void splice(iterator position, unrolled_dlist& other, iterator i)
+*		@brief:		Moves the value at i from other in front of position
+*		@pram:		iterator position [in] Position in this list the value goes in front of.
+*					unrolled_dlist& other [in/out] list holding i, may be this list.
+*					iterator i [in] value to be moved.
+*		@return:	void.
+*		@pre:	    position must belong to this list and i must reference a value of other
+*		@post:		Between lists the value is moved so both lists stay packed, constant time*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::splice(const typename unrolled_dlist<T_, Allocator_>::iterator position, unrolled_dlist<T_, Allocator_>& other, typename unrolled_dlist<T_, Allocator_>::iterator i){
+	assert(!(&other != i.list_));
+	assert(!(i.node_ == other.head_));
+	if(this == &other){
+		iterator last = i;
+		splice(position, other, i, ++last);
+		return;
+	}
+	emplace(position, std::move(*i));
+	other.erase(i);
+}
+/*		@fn:		void splice(iterator position, unrolled_dlist& other, iterator first, iterator last)
+*		@brief:		Moves the values in [first, last) from other in front of position
+*		@pram:		iterator position [in] Position in this list the values go in front of.
+*					unrolled_dlist& other [in/out] list holding the range, may be this list.
+*					iterator first [in] first value to be moved.
+*					iterator last [in] one past the last value to be moved.
+*		@return:	void.
+*		@pre:	    position must belong to this list and not be inside the range, the range must belong to other
+*		@post:		The nodes at either end of the range and at position are cut so whole nodes are relinked,
+*						then the seams are merged where they fit. Iterators into the cut nodes are invalidated.
+*						When the allocators differ the values are moved one at a time instead*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::splice(const typename unrolled_dlist<T_, Allocator_>::iterator position, unrolled_dlist<T_, Allocator_>& other, typename unrolled_dlist<T_, Allocator_>::iterator first, typename unrolled_dlist<T_, Allocator_>::iterator last){
+	assert(!(this != position.list_));
+	assert(!(&other != first.list_));
+	iterator insertAt = position;
+	if(first == last || (this == &other && (insertAt == first || insertAt == last)))
+		return;
+	if(this != &other && !(this->alloc_ == other.alloc_)){
+		for(difference_type count = std::distance(first, last); count != 0; --count){
+			insertAt = ++emplace(insertAt, std::move(*first));
+			first = other.erase(first);
+		}
+		return;
+	}
+
+	//cutting LAST may move the values at and after it, and INSERTAT with them, to a new node
+	node_type* lastNode = other.cut(last, insertAt);
+	node_type* firstNode = other.cut(first, insertAt);
+	node_type* after = cut(insertAt, last);
+
+	size_type count = 0;
+	for(node_type* node = firstNode; node != lastNode; node = node->next_)
+		count += node->count_;
+	node_type* lastIn = lastNode->prev_;
+	node_type* before = firstNode->prev_;
+	before->next_ = lastNode;
+	lastNode->prev_ = before;
+
+	node_type* prevIn = after->prev_;
+	prevIn->next_ = firstNode;
+	firstNode->prev_ = prevIn;
+	lastIn->next_ = after;
+	after->prev_ = lastIn;
+	other.size_ -= count;
+	this->size_ += count;
+
+	if(this != &other)
+		other.mergeNext(before);
+	mergeNext(lastIn);
+	mergeNext(prevIn);
+}
+/*		@fn:		node_type* createNode()
+*		@brief:		Allocates an empty node
+*		@pram:		none.
+*		@return:	node_type* the node, linked to itself.
+*		@pre:		none.
+*		@post:		The node holds no value*/
+template<typename T_, typename Allocator_>
+typename unrolled_dlist<T_, Allocator_>::node_type* unrolled_dlist<T_, Allocator_>::createNode(){
+	node_type* node = node_traits::allocate(alloc_, 1);
+	::new(static_cast<void*>(node)) node_type;
+	node->next_ = node;
+	node->prev_ = node;
+	node->count_ = 0;
+	return node;
+}
+/*		@fn:		void destroyNode(node_type* node)
+*		@brief:		Destroys a node's values and gives the node back to the allocator
+*		@pram:		node_type* node [in] unlinked node.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The node is released*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::destroyNode(typename unrolled_dlist<T_, Allocator_>::node_type* node){
+	T_* values = node->values();
+	for(count_type index = 0; index < node->count_; ++index)
+		values[index].~value_type();
+	node_traits::deallocate(alloc_, node, 1);
+}
+/*		@fn:		void link(node_type* position, node_type* node)
+*		@brief:		Links node in front of position
+*		@pram:		node_type* position [in] node to link in front of.
+*					node_type* node [in] unlinked node.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		Only the links of the three nodes are written*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::link(typename unrolled_dlist<T_, Allocator_>::node_type* position, typename unrolled_dlist<T_, Allocator_>::node_type* node){
+	node->prev_ = position->prev_;
+	node->next_ = position;
+	position->prev_->next_ = node;
+	position->prev_ = node;
+}
+/*		@fn:		void unlink(node_type* node)
+*		@brief:		Unlinks node from its neighbours
+*		@pram:		node_type* node [in] linked node other than the head.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The neighbours are linked to each other*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::unlink(typename unrolled_dlist<T_, Allocator_>::node_type* node){
+	node->prev_->next_ = node->next_;
+	node->next_->prev_ = node->prev_;
+}
+/*		@fn:		node_type* cut(iterator at, iterator& follow)
+*		@brief:		Splits the node holding at so at starts a node
+*		@pram:		iterator at [in] position of this list to cut in front of.
+*					iterator& follow [in/out] iterator kept pointing at its value when the cut moves it.
+*		@return:	node_type* the node that starts with at, the head when at is the end.
+*		@pre:		at must belong to this list.
+*		@post:		The values from at to the end of its node are moved to a new node after it*/
+template<typename T_, typename Allocator_>
+typename unrolled_dlist<T_, Allocator_>::node_type* unrolled_dlist<T_, Allocator_>::cut(typename unrolled_dlist<T_, Allocator_>::iterator at, typename unrolled_dlist<T_, Allocator_>::iterator& follow){
+	if(at.index_ == 0)
+		return at.node_;
+	node_type* node = at.node_;
+	node_type* tail = createNode();
+	link(node->next_, tail);
+	T_* values = node->values();
+	for(count_type moved = at.index_; moved < node->count_; ++moved){
+		::new(static_cast<void*>(tail->values() + moved - at.index_)) value_type(std::move(values[moved]));
+		values[moved].~value_type();
+	}
+	tail->count_ = node->count_ - at.index_;
+	node->count_ = at.index_;
+	if(follow.node_ == node && follow.index_ >= at.index_){
+		follow.node_ = tail;
+		follow.index_ -= at.index_;
+	}
+	return tail;
+}
+/*		@fn:		void mergeNext(node_type* node)
+*		@brief:		Moves the values of the node after node into node when they fit
+*		@pram:		node_type* node [in] linked node, may be the head.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The emptied node is destroyed, nothing changes when either node is the head*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::mergeNext(typename unrolled_dlist<T_, Allocator_>::node_type* node){
+	node_type* next = node->next_;
+	if(node == head_ || next == head_ || node->count_ + next->count_ > node_capacity)
+		return;
+	T_* values = next->values();
+	for(count_type moved = 0; moved < next->count_; ++moved)
+		::new(static_cast<void*>(node->values() + node->count_ + moved)) value_type(std::move(values[moved]));
+	node->count_ += next->count_;
+	unlink(next);
+	destroyNode(next);
+}
+/*		@fn:		void dispose()
+*		@brief:		Destroys every node, the head included
+*		@pram:		none.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The list holds no nodes*/
+template<typename T_, typename Allocator_>
+void unrolled_dlist<T_, Allocator_>::dispose(){
+	if(head_ == nullptr)
+		return;
+	clear();
+	destroyNode(head_);
+	head_ = nullptr;
+}
+
+template<typename T_, typename Allocator_>
+class unrolled_dlist_iterator : public std::iterator<std::bidirectional_iterator_tag, T_>
+{
+	//Allow The Following class to access unrolled_dlist_iterator private members
+	template<typename U_, typename A_> friend class unrolled_dlist;
+	template<typename U_, typename A_> friend class const_unrolled_dlist_iterator;
+public:
+	typedef unrolled_dlist_node<T_>* node_ptr;
+	typedef typename unrolled_dlist_node<T_>::count_type count_type;
+
+	unrolled_dlist_iterator() : node_(nullptr), index_(0), list_(nullptr){ }
+	unrolled_dlist_iterator(node_ptr node, count_type index, unrolled_dlist<T_, Allocator_>* list) : node_(node), index_(index), list_(list){}
+
+	unrolled_dlist_iterator& operator++(){
+		if(++index_ >= node_->count_){
+			node_ = node_->next_;
+			index_ = 0;
+		}
+		return *this;
+	}
+	unrolled_dlist_iterator operator++(int){unrolled_dlist_iterator temp(*this); ++*this; return temp;}
+	unrolled_dlist_iterator& operator--(){
+		if(index_ == 0){
+			node_ = node_->prev_;
+			index_ = node_->count_;
+		}
+		--index_;
+		return *this;
+	}
+	unrolled_dlist_iterator operator--(int){unrolled_dlist_iterator temp(*this); --*this; return temp;}
+
+	T_& operator*() const{assert(!(node_ == list_->head_)); return node_->values()[index_];}
+	T_* operator->() const{return &**this;}
+	bool operator==(unrolled_dlist_iterator const& rhs) const{return node_ == rhs.node_ && index_ == rhs.index_ && list_ == rhs.list_;}
+	bool operator!=(unrolled_dlist_iterator const& rhs) const{return !(*this == rhs);}
+private:
+	node_ptr node_;
+	count_type index_;
+	unrolled_dlist<T_, Allocator_>* list_;
+};
+
+template<typename T_, typename Allocator_>
+class const_unrolled_dlist_iterator : public std::iterator<std::bidirectional_iterator_tag, T_, std::ptrdiff_t, T_ const*, T_ const&>
+{
+	//Allow The Following class to access const_unrolled_dlist_iterator private members
+	template<typename U_, typename A_> friend class unrolled_dlist;
+public:
+	typedef unrolled_dlist_node<T_> const* node_ptr;
+	typedef typename unrolled_dlist_node<T_>::count_type count_type;
+
+	const_unrolled_dlist_iterator() : node_(nullptr), index_(0), list_(nullptr){ }
+	const_unrolled_dlist_iterator(node_ptr node, count_type index, unrolled_dlist<T_, Allocator_> const* list) : node_(node), index_(index), list_(list){}
+	const_unrolled_dlist_iterator(unrolled_dlist_iterator<T_, Allocator_> const& iter) : node_(iter.node_), index_(iter.index_), list_(iter.list_){}
+
+	const_unrolled_dlist_iterator& operator++(){
+		if(++index_ >= node_->count_){
+			node_ = node_->next_;
+			index_ = 0;
+		}
+		return *this;
+	}
+	const_unrolled_dlist_iterator operator++(int){const_unrolled_dlist_iterator temp(*this); ++*this; return temp;}
+	const_unrolled_dlist_iterator& operator--(){
+		if(index_ == 0){
+			node_ = node_->prev_;
+			index_ = node_->count_;
+		}
+		--index_;
+		return *this;
+	}
+	const_unrolled_dlist_iterator operator--(int){const_unrolled_dlist_iterator temp(*this); --*this; return temp;}
+
+	T_ const& operator*() const{assert(!(node_ == list_->head_)); return node_->values()[index_];}
+	T_ const* operator->() const{return &**this;}
+	bool operator==(const_unrolled_dlist_iterator const& rhs) const{return node_ == rhs.node_ && index_ == rhs.index_ && list_ == rhs.list_;}
+	bool operator!=(const_unrolled_dlist_iterator const& rhs) const{return !(*this == rhs);}
+private:
+	node_ptr node_;
+	count_type index_;
+	unrolled_dlist<T_, Allocator_> const* list_;
+};
+#endif
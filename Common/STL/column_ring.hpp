@@ -0,0 +1,517 @@
+#if !defined( GUARD_STL_COLUMN_RING_HPP_ )
+#define GUARD_STL_COLUMN_RING_HPP_
+
+/** @file: column_ring.hpp
+@author Robbie Brandrick
+@author r_brandrick@fanshaweonline.ca
+@date 2012-02-24
+@version 0.1.0
+@note Targets Visual C++ 10.0
+@briefs column_ring class definition and implementation.
+		column_ring iterator definition and implementation
+		column_ring constant iterator definition and implementation
+		A contiguous vertical list for the squarelist kept as a circular buffer, values are pushed and
+		popped at both ends in constant time so the shifts balancing does never move a whole column.
+@invariant  the buffer capacity is zero or a power of two, the values are the size_ slots starting at head_*/
+
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+#include <cassert>
+
+//forward declare iterators
+template<typename T_, typename Allocator_ = std::allocator<T_>> class column_ring_iterator;
+template<typename T_, typename Allocator_ = std::allocator<T_>> class const_column_ring_iterator;
+
+/*column_ring class definition*/
+template<typename T_, typename Allocator_ = std::allocator<T_>>
+class column_ring{
+		friend class column_ring_iterator<T_, Allocator_>;
+		friend class const_column_ring_iterator<T_, Allocator_>;
+		typedef std::allocator_traits<Allocator_>		alloc_traits;
+public:
+		typedef std::size_t								size_type;
+		typedef std::ptrdiff_t							difference_type;
+		typedef T_										value_type;
+		typedef T_ &									reference;
+		typedef T_ const &								const_reference;
+		typedef typename alloc_traits::pointer			pointer;
+		typedef typename alloc_traits::const_pointer	const_pointer;
+		typedef Allocator_								allocator_type;
+
+		typedef column_ring_iterator<T_, Allocator_>			iterator;
+		typedef const_column_ring_iterator<T_, Allocator_>		const_iterator;
+		typedef std::reverse_iterator<iterator>					reverse_iterator;
+		typedef std::reverse_iterator<const_iterator>			const_reverse_iterator;
+private:
+		Allocator_		alloc_;
+		pointer			buffer_;
+		size_type		capacity_;
+		size_type		head_;
+		size_type		size_;
+public:
+		column_ring();
+		explicit column_ring( Allocator_ const& alloc );
+		column_ring( column_ring<T_, Allocator_> const& ring );
+		column_ring( column_ring<T_, Allocator_> && ring );
+		~column_ring();
+
+		column_ring<T_, Allocator_>& operator=(column_ring<T_, Allocator_> const& rhs);
+		column_ring<T_, Allocator_>& operator=(column_ring<T_, Allocator_> && rhs);
+
+		iterator begin(){ return iterator(this, 0); }
+		const_iterator begin() const{ return const_iterator(this, 0); }
+		const_iterator cbegin() const{ return const_iterator(this, 0); }
+		iterator end(){ return iterator(this, size_); }
+		const_iterator end() const{ return const_iterator(this, size_); }
+		const_iterator cend() const{ return const_iterator(this, size_); }
+
+		size_type size() const{ return size_; }
+		bool empty() const{ return size_ == 0; }
+		size_type capacity() const{ return capacity_; }
+		void reserve(size_type count);
+		allocator_type get_allocator() const{ return alloc_; }
+
+		reference front(){ return slot(0); }
+		const_reference front() const{ return slot(0); }
+		reference back(){ return slot(size_ - 1); }
+		const_reference back() const{ return slot(size_ - 1); }
+
+		void push_back(const_reference x);
+		void push_back(value_type&& x);
+		void push_front(const_reference x);
+		void push_front(value_type&& x);
+		void pop_back();
+		void pop_front();
+
+		iterator insert(const_iterator pos, const_reference x);
+		iterator insert(const_iterator pos, value_type&& x);
+		iterator erase(const_iterator pos);
+		iterator erase(const_iterator first, const_iterator last);
+		void clear();
+		void swap(column_ring<T_, Allocator_>& rhs);
+
+		void splice(const_iterator pos, column_ring<T_, Allocator_>& other, const_iterator x);
+		void splice(const_iterator pos, column_ring<T_, Allocator_>& other, const_iterator first, const_iterator last);
+private:
+		reference slot(size_type index){ return buffer_[(head_ + index) & (capacity_ - 1)]; }
+		const_reference slot(size_type index) const{ return buffer_[(head_ + index) & (capacity_ - 1)]; }
+		pointer slotAddress(size_type index){ return buffer_ + ((head_ + index) & (capacity_ - 1)); }
+		void grow(size_type count);
+		void makeRoom();
+};
+
+/*		@fn:		column_ring()
+*		@brief:		Constructor
+*		@pram:		None.
+*		@return:	nothing
+*		@pre:		none.
+*		@post:		an empty column_ring object is created, no buffer is allocated until a value is added.
+*/
+template<typename T_, typename Allocator_>
+column_ring<T_, Allocator_>::column_ring() : alloc_(), buffer_(nullptr), capacity_(0), head_(0), size_(0){}
+
+/*		@fn:		column_ring( Allocator_ const& alloc )
+*		@brief:		Constructor taking the allocator
+*		@pram:		Allocator_ const& alloc [in] allocator the buffer is taken from
+*		@return:	nothing
+*		@pre:		none.
+*		@post:		an empty column_ring object is created.
+*/
+template<typename T_, typename Allocator_>
+column_ring<T_, Allocator_>::column_ring( Allocator_ const& alloc ) : alloc_(alloc), buffer_(nullptr), capacity_(0), head_(0), size_(0){}
+
+/*		@fn:		column_ring( column_ring<T_, Allocator_> const& ring )
+*		@brief:		Copy Constructor
+*		@pram:		column_ring<T_, Allocator_> const& ring [in] ring to copy
+*		@return:	nothing
+*		@pre:		none.
+*		@post:		the values are copied in order to the front of a buffer just large enough to hold them.
+*/
+template<typename T_, typename Allocator_>
+column_ring<T_, Allocator_>::column_ring( column_ring<T_, Allocator_> const& ring )
+	: alloc_(alloc_traits::select_on_container_copy_construction(ring.alloc_)), buffer_(nullptr), capacity_(0), head_(0), size_(0){
+		this->reserve(ring.size_);
+		for(size_type index = 0; index < ring.size_; ++index)
+				this->push_back(ring.slot(index));
+}
+/*		@fn:		column_ring( column_ring<T_, Allocator_> && ring )
+*		@brief:		Move Constructor
+*		@pram:		column_ring<T_, Allocator_> && ring [in] ring to take the buffer from
+*		@return:	nothing
+*		@pre:		none.
+*		@post:		the buffer is taken over, RING is left empty.
+*/
+template<typename T_, typename Allocator_>
+column_ring<T_, Allocator_>::column_ring( column_ring<T_, Allocator_> && ring )
+	: alloc_(std::move(ring.alloc_)), buffer_(ring.buffer_), capacity_(ring.capacity_), head_(ring.head_), size_(ring.size_){
+		ring.buffer_ = nullptr;
+		ring.capacity_ = ring.head_ = ring.size_ = 0;
+}
+/*		@fn:		~column_ring()
+*		@brief:		Destructor
+*		@pram:		None.
+*		@return:	nothing
+*		@pre:		none.
+*		@post:		the values are destroyed and the buffer is given back to the allocator.
+*/
+template<typename T_, typename Allocator_>
+column_ring<T_, Allocator_>::~column_ring(){
+		this->clear();
+		if(this->buffer_)
+				alloc_traits::deallocate(this->alloc_, this->buffer_, this->capacity_);
+}
+/*		@fn:        column_ring<T_, Allocator_>& operator=(column_ring<T_, Allocator_> const& rhs);
+*		@brief:		Assignment operator
+*		@pram:		column_ring<T_, Allocator_> const& rhs [in] ring to be assigned to this.
+*		@return:	a reference to the column_ring
+*		@pre:		None.
+*		@post:		This column_ring holds copies of the values of rhs*/
+template<typename T_, typename Allocator_>
+column_ring<T_, Allocator_>& column_ring<T_, Allocator_>::operator=(column_ring<T_, Allocator_> const& rhs){
+		if(this != &rhs){
+				column_ring<T_, Allocator_> copy(rhs);
+				this->swap(copy);
+		}
+		return *this;
+}
+/*		@fn:        column_ring<T_, Allocator_>& operator=(column_ring<T_, Allocator_> && rhs);
+*		@brief:		Move Assignment operator
+*		@pram:		column_ring<T_, Allocator_> && rhs [in] ring to be moved to this.
+*		@return:	a reference to the column_ring
+*		@pre:		None.
+*		@post:		This column_ring owns the buffer of rhs, rhs is left empty*/
+template<typename T_, typename Allocator_>
+column_ring<T_, Allocator_>& column_ring<T_, Allocator_>::operator=(column_ring<T_, Allocator_> && rhs){
+		if(this != &rhs){
+				column_ring<T_, Allocator_> taken(std::move(rhs));
+				this->swap(taken);
+		}
+		return *this;
+}
+/*		@fn:        void swap(column_ring<T_, Allocator_>& rhs);
+*		@brief:		Exchanges the buffers of two rings
+*		@pram:		column_ring<T_, Allocator_>& rhs [in/out] ring to swap with
+*		@return:	void
+*		@pre:		None.
+*		@post:		No value is moved or copied*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::swap(column_ring<T_, Allocator_>& rhs){
+		std::swap(this->alloc_, rhs.alloc_);
+		std::swap(this->buffer_, rhs.buffer_);
+		std::swap(this->capacity_, rhs.capacity_);
+		std::swap(this->head_, rhs.head_);
+		std::swap(this->size_, rhs.size_);
+}
+/*		@fn:        void reserve(size_type count);
+*		@brief:		Makes sure COUNT values fit without growing the buffer
+*		@pram:		size_type count [in] number of values to make room for
+*		@return:	void
+*		@pre:		None.
+*		@post:		The capacity is the smallest power of two not less than COUNT, or is unchanged if already large enough*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::reserve(size_type count){
+		if(count <= this->capacity_)
+				return;
+		size_type capacity = this->capacity_ ? this->capacity_ : 1;
+		while(capacity < count)
+				capacity *= 2;
+		this->grow(capacity);
+}
+/*		@fn:        void grow(size_type count);
+*		@brief:		Moves the values to the front of a new buffer of COUNT slots
+*		@pram:		size_type count [in] new capacity, a power of two
+*		@return:	void
+*		@pre:		COUNT must be at least size().
+*		@post:		head_ is zero, the old buffer is given back to the allocator*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::grow(size_type count){
+		pointer buffer = alloc_traits::allocate(this->alloc_, count);
+		for(size_type index = 0; index < this->size_; ++index){
+				alloc_traits::construct(this->alloc_, std::addressof(buffer[index]), std::move(this->slot(index)));
+				alloc_traits::destroy(this->alloc_, this->slotAddress(index));
+		}
+		if(this->buffer_)
+				alloc_traits::deallocate(this->alloc_, this->buffer_, this->capacity_);
+		this->buffer_ = buffer;
+		this->capacity_ = count;
+		this->head_ = 0;
+}
+/*		@fn:        void makeRoom();
+*		@brief:		Doubles the buffer if every slot holds a value
+*		@pram:		None.
+*		@return:	void
+*		@pre:		None.
+*		@post:		There is at least one free slot*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::makeRoom(){
+		if(this->size_ == this->capacity_)
+				this->grow(this->capacity_ ? this->capacity_ * 2 : 4);
+}
+/*		@fn:        void push_back(const_reference x);
+*		@brief:		Copies a value after the back of the ring
+*		@pram:		const_reference x [in] value to be copied in
+*		@return:	void
+*		@pre:		None.
+*		@post:		X is the back of the ring, no other value is moved unless the buffer grew*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::push_back(typename column_ring<T_, Allocator_>::const_reference x){
+		this->push_back(value_type(x));
+}
+/*		@fn:        void push_back(value_type&& x);
+*		@brief:		Moves a value after the back of the ring
+*		@pram:		value_type&& x [in] value to be moved in
+*		@return:	void
+*		@pre:		None.
+*		@post:		X is the back of the ring, no other value is moved unless the buffer grew*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::push_back(typename column_ring<T_, Allocator_>::value_type&& x){
+		this->makeRoom();
+		alloc_traits::construct(this->alloc_, this->slotAddress(this->size_), std::move(x));
+		++this->size_;
+}
+/*		@fn:        void push_front(const_reference x);
+*		@brief:		Copies a value in front of the ring
+*		@pram:		const_reference x [in] value to be copied in
+*		@return:	void
+*		@pre:		None.
+*		@post:		X is the front of the ring, no other value is moved unless the buffer grew*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::push_front(typename column_ring<T_, Allocator_>::const_reference x){
+		this->push_front(value_type(x));
+}
+/*		@fn:        void push_front(value_type&& x);
+*		@brief:		Moves a value in front of the ring
+*		@pram:		value_type&& x [in] value to be moved in
+*		@return:	void
+*		@pre:		None.
+*		@post:		X is the front of the ring, no other value is moved unless the buffer grew*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::push_front(typename column_ring<T_, Allocator_>::value_type&& x){
+		this->makeRoom();
+		this->head_ = (this->head_ + this->capacity_ - 1) & (this->capacity_ - 1);
+		alloc_traits::construct(this->alloc_, this->slotAddress(0), std::move(x));
+		++this->size_;
+}
+/*		@fn:        void pop_back();
+*		@brief:		Removes the back value of the ring
+*		@pram:		None.
+*		@return:	void
+*		@pre:		The ring must not be empty.
+*		@post:		No other value is moved*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::pop_back(){
+		assert(this->size_ != 0);
+		alloc_traits::destroy(this->alloc_, this->slotAddress(this->size_ - 1));
+		--this->size_;
+}
+/*		@fn:        void pop_front();
+*		@brief:		Removes the front value of the ring
+*		@pram:		None.
+*		@return:	void
+*		@pre:		The ring must not be empty.
+*		@post:		No other value is moved*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::pop_front(){
+		assert(this->size_ != 0);
+		alloc_traits::destroy(this->alloc_, this->slotAddress(0));
+		this->head_ = (this->head_ + 1) & (this->capacity_ - 1);
+		--this->size_;
+}
+/*		@fn:        iterator insert(const_iterator pos, const_reference x);
+*		@brief:		Copies a value into the ring before POS
+*		@pram:		const_iterator pos [in] value the new value goes in front of
+*					const_reference x [in] value to be copied in
+*		@return:	iterator to the new value
+*		@pre:		POS must belong to this ring.
+*		@post:		Only the values between POS and the nearer end are moved*/
+template<typename T_, typename Allocator_>
+typename column_ring<T_, Allocator_>::iterator column_ring<T_, Allocator_>::insert(typename column_ring<T_, Allocator_>::const_iterator pos, typename column_ring<T_, Allocator_>::const_reference x){
+		return this->insert(pos, value_type(x));
+}
+/*		@fn:        iterator insert(const_iterator pos, value_type&& x);
+*		@brief:		Moves a value into the ring before POS
+*		@pram:		const_iterator pos [in] value the new value goes in front of
+*					value_type&& x [in] value to be moved in
+*		@return:	iterator to the new value
+*		@pre:		POS must belong to this ring.
+*		@post:		Only the values between POS and the nearer end are moved*/
+template<typename T_, typename Allocator_>
+typename column_ring<T_, Allocator_>::iterator column_ring<T_, Allocator_>::insert(typename column_ring<T_, Allocator_>::const_iterator pos, typename column_ring<T_, Allocator_>::value_type&& x){
+		size_type index = pos.index_;
+		//grow first so the values slid below are not moved out from under the push
+		this->makeRoom();
+		if(index == 0){
+				this->push_front(std::move(x));
+		} else if(index == this->size_){
+				this->push_back(std::move(x));
+		} else if(index < this->size_ - index){
+				//open the slot by sliding the values in front of it forward
+				this->push_front(std::move(this->slot(0)));
+				for(size_type move = 1; move < index; ++move)
+						this->slot(move) = std::move(this->slot(move + 1));
+				this->slot(index) = std::move(x);
+		} else {
+				//open the slot by sliding the values behind it back
+				this->push_back(std::move(this->slot(this->size_ - 1)));
+				for(size_type move = this->size_ - 2; move > index; --move)
+						this->slot(move) = std::move(this->slot(move - 1));
+				this->slot(index) = std::move(x);
+		}
+		return iterator(this, index);
+}
+/*		@fn:        iterator erase(const_iterator pos);
+*		@brief:		Removes the value at POS
+*		@pram:		const_iterator pos [in] value to be removed
+*		@return:	iterator to the value that followed POS
+*		@pre:		POS must reference a value of this ring.
+*		@post:		Only the values between POS and the nearer end are moved*/
+template<typename T_, typename Allocator_>
+typename column_ring<T_, Allocator_>::iterator column_ring<T_, Allocator_>::erase(typename column_ring<T_, Allocator_>::const_iterator pos){
+		return this->erase(pos, pos + 1);
+}
+/*		@fn:        iterator erase(const_iterator first, const_iterator last);
+*		@brief:		Removes the values in [FIRST, LAST)
+*		@pram:		const_iterator first [in] first value to be removed
+*					const_iterator last [in] one past the last value to be removed
+*		@return:	iterator to the value that followed the range
+*		@pre:		The range must belong to this ring.
+*		@post:		The shorter of the two runs outside the range is slid over it*/
+template<typename T_, typename Allocator_>
+typename column_ring<T_, Allocator_>::iterator column_ring<T_, Allocator_>::erase(typename column_ring<T_, Allocator_>::const_iterator first, typename column_ring<T_, Allocator_>::const_iterator last){
+		size_type from = first.index_, to = last.index_, count = to - from;
+		if(count == 0)
+				return iterator(this, from);
+		if(from < this->size_ - to){
+				for(size_type move = from; move > 0; --move)
+						this->slot(move - 1 + count) = std::move(this->slot(move - 1));
+				for(size_type pop = 0; pop < count; ++pop)
+						this->pop_front();
+		} else {
+				for(size_type move = to; move < this->size_; ++move)
+						this->slot(move - count) = std::move(this->slot(move));
+				for(size_type pop = 0; pop < count; ++pop)
+						this->pop_back();
+		}
+		return iterator(this, from);
+}
+/*		@fn:        void clear();
+*		@brief:		Removes every value of the ring
+*		@pram:		None.
+*		@return:	void
+*		@pre:		None.
+*		@post:		The ring is empty, the buffer is kept*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::clear(){
+		while(this->size_ != 0)
+				this->pop_back();
+		this->head_ = 0;
+}
+/*		@fn:        void splice(const_iterator pos, column_ring& other, const_iterator x);
+*		@brief:		Moves the value at X out of OTHER and in front of POS
+*		@pram:		const_iterator pos [in] value the moved value goes in front of
+*					column_ring& other [in/out] ring holding X
+*					const_iterator x [in] value to be moved
+*		@return:	void
+*		@pre:		X must reference a value of OTHER, OTHER must not be this ring.
+*		@post:		Unlike std::list the value is moved and not relinked, iterators into OTHER may be invalidated*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::splice(typename column_ring<T_, Allocator_>::const_iterator pos, column_ring<T_, Allocator_>& other, typename column_ring<T_, Allocator_>::const_iterator x){
+		this->insert(pos, std::move(other.slot(x.index_)));
+		other.erase(x);
+}
+/*		@fn:        void splice(const_iterator pos, column_ring& other, const_iterator first, const_iterator last);
+*		@brief:		Moves the values in [FIRST, LAST) out of OTHER and in front of POS
+*		@pram:		const_iterator pos [in] value the moved values go in front of
+*					column_ring& other [in/out] ring holding the range
+*					const_iterator first [in] first value to be moved
+*					const_iterator last [in] one past the last value to be moved
+*		@return:	void
+*		@pre:		The range must belong to OTHER, OTHER must not be this ring.
+*		@post:		The values are moved in order, iterators into OTHER may be invalidated*/
+template<typename T_, typename Allocator_>
+void column_ring<T_, Allocator_>::splice(typename column_ring<T_, Allocator_>::const_iterator pos, column_ring<T_, Allocator_>& other, typename column_ring<T_, Allocator_>::const_iterator first, typename column_ring<T_, Allocator_>::const_iterator last){
+		size_type index = pos.index_;
+		this->reserve(this->size_ + (last.index_ - first.index_));
+		for(size_type take = first.index_; take < last.index_; ++take)
+				this->insert(const_iterator(this, index++), std::move(other.slot(take)));
+		other.erase(first, last);
+}
+
+/*column_ring iterator class definition, an index into the ring so it survives the head wrapping*/
+template<typename T_, typename Allocator_>
+class column_ring_iterator : public std::iterator<std::random_access_iterator_tag, T_, std::ptrdiff_t, T_ *, T_ &>{
+		friend class column_ring<T_, Allocator_>;
+		friend class const_column_ring_iterator<T_, Allocator_>;
+public:
+		column_ring_iterator() : ring_(nullptr), index_(0){}
+		column_ring_iterator(column_ring<T_, Allocator_>* ring, std::size_t index) : ring_(ring), index_(index){}
+
+		T_& operator*() const{ return ring_->slot(index_); }
+		T_* operator->() const{ return std::addressof(ring_->slot(index_)); }
+		T_& operator[](std::ptrdiff_t n) const{ return ring_->slot(index_ + n); }
+
+		column_ring_iterator& operator++(){ ++index_; return *this; }
+		column_ring_iterator operator++(int){ column_ring_iterator temp = *this; ++index_; return temp; }
+		column_ring_iterator& operator--(){ --index_; return *this; }
+		column_ring_iterator operator--(int){ column_ring_iterator temp = *this; --index_; return temp; }
+		column_ring_iterator& operator+=(std::ptrdiff_t n){ index_ += n; return *this; }
+		column_ring_iterator& operator-=(std::ptrdiff_t n){ index_ -= n; return *this; }
+		column_ring_iterator operator+(std::ptrdiff_t n) const{ return column_ring_iterator(ring_, index_ + n); }
+		column_ring_iterator operator-(std::ptrdiff_t n) const{ return column_ring_iterator(ring_, index_ - n); }
+		std::ptrdiff_t operator-(column_ring_iterator const& rhs) const{ return static_cast<std::ptrdiff_t>(index_) - static_cast<std::ptrdiff_t>(rhs.index_); }
+
+		bool operator==(column_ring_iterator const& rhs) const{ return index_ == rhs.index_ && ring_ == rhs.ring_; }
+		bool operator!=(column_ring_iterator const& rhs) const{ return !(*this == rhs); }
+		bool operator<(column_ring_iterator const& rhs) const{ return index_ < rhs.index_; }
+		bool operator>(column_ring_iterator const& rhs) const{ return rhs < *this; }
+		bool operator<=(column_ring_iterator const& rhs) const{ return !(rhs < *this); }
+		bool operator>=(column_ring_iterator const& rhs) const{ return !(*this < rhs); }
+private:
+		column_ring<T_, Allocator_>*	ring_;
+		std::size_t						index_;
+};
+template<typename T_, typename Allocator_>
+column_ring_iterator<T_, Allocator_> operator+(std::ptrdiff_t n, column_ring_iterator<T_, Allocator_> const& it){
+		return it + n;
+}
+
+/*column_ring constant iterator class definition*/
+template<typename T_, typename Allocator_>
+class const_column_ring_iterator : public std::iterator<std::random_access_iterator_tag, T_, std::ptrdiff_t, T_ const *, T_ const &>{
+		friend class column_ring<T_, Allocator_>;
+public:
+		const_column_ring_iterator() : ring_(nullptr), index_(0){}
+		const_column_ring_iterator(column_ring<T_, Allocator_> const* ring, std::size_t index) : ring_(ring), index_(index){}
+		const_column_ring_iterator(column_ring_iterator<T_, Allocator_> const& it) : ring_(it.ring_), index_(it.index_){}
+
+		T_ const& operator*() const{ return ring_->slot(index_); }
+		T_ const* operator->() const{ return std::addressof(ring_->slot(index_)); }
+		T_ const& operator[](std::ptrdiff_t n) const{ return ring_->slot(index_ + n); }
+
+		const_column_ring_iterator& operator++(){ ++index_; return *this; }
+		const_column_ring_iterator operator++(int){ const_column_ring_iterator temp = *this; ++index_; return temp; }
+		const_column_ring_iterator& operator--(){ --index_; return *this; }
+		const_column_ring_iterator operator--(int){ const_column_ring_iterator temp = *this; --index_; return temp; }
+		const_column_ring_iterator& operator+=(std::ptrdiff_t n){ index_ += n; return *this; }
+		const_column_ring_iterator& operator-=(std::ptrdiff_t n){ index_ -= n; return *this; }
+		const_column_ring_iterator operator+(std::ptrdiff_t n) const{ return const_column_ring_iterator(ring_, index_ + n); }
+		const_column_ring_iterator operator-(std::ptrdiff_t n) const{ return const_column_ring_iterator(ring_, index_ - n); }
+		std::ptrdiff_t operator-(const_column_ring_iterator const& rhs) const{ return static_cast<std::ptrdiff_t>(index_) - static_cast<std::ptrdiff_t>(rhs.index_); }
+
+		bool operator==(const_column_ring_iterator const& rhs) const{ return index_ == rhs.index_ && ring_ == rhs.ring_; }
+		bool operator!=(const_column_ring_iterator const& rhs) const{ return !(*this == rhs); }
+		bool operator<(const_column_ring_iterator const& rhs) const{ return index_ < rhs.index_; }
+		bool operator>(const_column_ring_iterator const& rhs) const{ return rhs < *this; }
+		bool operator<=(const_column_ring_iterator const& rhs) const{ return !(rhs < *this); }
+		bool operator>=(const_column_ring_iterator const& rhs) const{ return !(*this < rhs); }
+private:
+		column_ring<T_, Allocator_> const*	ring_;
+		std::size_t							index_;
+};
+template<typename T_, typename Allocator_>
+const_column_ring_iterator<T_, Allocator_> operator+(std::ptrdiff_t n, const_column_ring_iterator<T_, Allocator_> const& it){
+		return it + n;
+}
+#endif
@@ -0,0 +1,182 @@
+#if !defined( GUARD_STL_COLUMN_VECTOR_HPP_ )
+#define GUARD_STL_COLUMN_VECTOR_HPP_
+
+/** @file: column_vector.hpp
+@author Robbie Brandrick
+@author r_brandrick@fanshaweonline.ca
+@date 2012-02-24
+@version 0.1.0
+@note Targets Visual C++ 10.0
+@briefs column_vector class definition and implementation.
+		A contiguous vertical list for the squarelist, it offers the part of the std::list
+		interface the squarelist uses so squarelist<T_, Compare_, Allocator_, column_vector<T_, Allocator_>>
+		lays the square list out as a tiered vector.
+@invariant  column_vector values are stored contiguously in a single buffer*/
+
+#include <vector>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+
+/*column_vector class definition*/
+template<typename T_, typename Allocator_ = std::allocator<T_>>
+class column_vector{
+		typedef std::vector<T_, Allocator_>		buffer;
+public:
+		typedef typename buffer::size_type				size_type;
+		typedef typename buffer::difference_type		difference_type;
+		typedef typename buffer::value_type				value_type;
+		typedef typename buffer::reference				reference;
+		typedef typename buffer::const_reference		const_reference;
+		typedef typename buffer::pointer				pointer;
+		typedef typename buffer::const_pointer			const_pointer;
+		typedef typename buffer::iterator				iterator;
+		typedef typename buffer::const_iterator			const_iterator;
+		typedef typename buffer::reverse_iterator		reverse_iterator;
+		typedef typename buffer::const_reverse_iterator	const_reverse_iterator;
+		typedef Allocator_								allocator_type;
+private:
+		buffer		values_;
+public:
+		column_vector(){}
+		explicit column_vector( Allocator_ const& alloc ) : values_(alloc){}
+
+		iterator begin(){ return values_.begin(); }
+		const_iterator begin() const{ return values_.begin(); }
+		const_iterator cbegin() const{ return values_.cbegin(); }
+		iterator end(){ return values_.end(); }
+		const_iterator end() const{ return values_.end(); }
+		const_iterator cend() const{ return values_.cend(); }
+
+		size_type size() const{ return values_.size(); }
+		bool empty() const{ return values_.empty(); }
+		void reserve(size_type count){ values_.reserve(count); }
+		allocator_type get_allocator() const{ return values_.get_allocator(); }
+
+		reference front(){ return values_.front(); }
+		const_reference front() const{ return values_.front(); }
+		reference back(){ return values_.back(); }
+		const_reference back() const{ return values_.back(); }
+
+		void push_back(const_reference x){ values_.push_back(x); }
+		void push_back(value_type&& x){ values_.push_back(std::move(x)); }
+		void push_front(const_reference x);
+		void push_front(value_type&& x);
+		void pop_back(){ values_.pop_back(); }
+		void pop_front();
+
+		iterator insert(const_iterator pos, const_reference x);
+		iterator insert(const_iterator pos, value_type&& x);
+		iterator erase(const_iterator pos);
+		iterator erase(const_iterator first, const_iterator last);
+		void clear(){ values_.clear(); }
+
+		void splice(const_iterator pos, column_vector<T_, Allocator_>& other, const_iterator x);
+		void splice(const_iterator pos, column_vector<T_, Allocator_>& other, const_iterator first, const_iterator last);
+};
+
+/*		@fn:        void push_front(const_reference x);
+*		@brief:		Puts a value in front of the column
+*		@pram:		const_reference x [in] value to be copied in
+*		@return:	void
+*		@pre:		None.
+*		@post:		X is the front of the column, the other values are moved back one slot in a single pass*/
+template<typename T_, typename Allocator_>
+void column_vector<T_, Allocator_>::push_front(typename column_vector<T_, Allocator_>::const_reference x){
+		this->values_.insert(this->values_.begin(), x);
+}
+/*		@fn:        void push_front(value_type&& x);
+*		@brief:		Moves a value in front of the column
+*		@pram:		value_type&& x [in] value to be moved in
+*		@return:	void
+*		@pre:		None.
+*		@post:		X is the front of the column, the other values are moved back one slot in a single pass*/
+template<typename T_, typename Allocator_>
+void column_vector<T_, Allocator_>::push_front(typename column_vector<T_, Allocator_>::value_type&& x){
+		this->values_.insert(this->values_.begin(), std::move(x));
+}
+/*		@fn:        void pop_front();
+*		@brief:		Removes the front value of the column
+*		@pram:		None.
+*		@return:	void
+*		@pre:		The column must not be empty.
+*		@post:		The other values are moved forward one slot in a single pass*/
+template<typename T_, typename Allocator_>
+void column_vector<T_, Allocator_>::pop_front(){
+		this->values_.erase(this->values_.begin());
+}
+/*		@fn:        iterator insert(const_iterator pos, const_reference x);
+*		@brief:		Copies a value into the column before POS
+*		@pram:		const_iterator pos [in] value the new value goes in front of
+*					const_reference x [in] value to be copied in
+*		@return:	iterator to the new value
+*		@pre:		POS must belong to this column.
+*		@post:		Iterators at or after POS are invalidated, all of them if the buffer grew*/
+template<typename T_, typename Allocator_>
+typename column_vector<T_, Allocator_>::iterator column_vector<T_, Allocator_>::insert(typename column_vector<T_, Allocator_>::const_iterator pos, typename column_vector<T_, Allocator_>::const_reference x){
+		return this->values_.insert(pos, x);
+}
+/*		@fn:        iterator insert(const_iterator pos, value_type&& x);
+*		@brief:		Moves a value into the column before POS
+*		@pram:		const_iterator pos [in] value the new value goes in front of
+*					value_type&& x [in] value to be moved in
+*		@return:	iterator to the new value
+*		@pre:		POS must belong to this column.
+*		@post:		Iterators at or after POS are invalidated, all of them if the buffer grew*/
+template<typename T_, typename Allocator_>
+typename column_vector<T_, Allocator_>::iterator column_vector<T_, Allocator_>::insert(typename column_vector<T_, Allocator_>::const_iterator pos, typename column_vector<T_, Allocator_>::value_type&& x){
+		return this->values_.insert(pos, std::move(x));
+}
+/*		@fn:        iterator erase(const_iterator pos);
+*		@brief:		Removes the value at POS
+*		@pram:		const_iterator pos [in] value to be removed
+*		@return:	iterator to the value that followed POS
+*		@pre:		POS must reference a value of this column.
+*		@post:		Iterators at or after POS are invalidated*/
+template<typename T_, typename Allocator_>
+typename column_vector<T_, Allocator_>::iterator column_vector<T_, Allocator_>::erase(typename column_vector<T_, Allocator_>::const_iterator pos){
+		return this->values_.erase(pos);
+}
+/*		@fn:        iterator erase(const_iterator first, const_iterator last);
+*		@brief:		Removes the values in [FIRST, LAST)
+*		@pram:		const_iterator first [in] first value to be removed
+*					const_iterator last [in] one past the last value to be removed
+*		@return:	iterator to the value that followed the range
+*		@pre:		The range must belong to this column.
+*		@post:		Iterators at or after FIRST are invalidated*/
+template<typename T_, typename Allocator_>
+typename column_vector<T_, Allocator_>::iterator column_vector<T_, Allocator_>::erase(typename column_vector<T_, Allocator_>::const_iterator first, typename column_vector<T_, Allocator_>::const_iterator last){
+		return this->values_.erase(first, last);
+}
+/*		@fn:        void splice(const_iterator pos, column_vector& other, const_iterator x);
+*		@brief:		Moves the value at X out of OTHER and in front of POS
+*		@pram:		const_iterator pos [in] value the moved value goes in front of
+*					column_vector& other [in/out] column holding X
+*					const_iterator x [in] value to be moved
+*		@return:	void
+*		@pre:		X must reference a value of OTHER, OTHER must not be this column.
+*		@post:		Unlike std::list the value is moved and not relinked, iterators into OTHER at or after X are invalidated*/
+template<typename T_, typename Allocator_>
+void column_vector<T_, Allocator_>::splice(typename column_vector<T_, Allocator_>::const_iterator pos, column_vector<T_, Allocator_>& other, typename column_vector<T_, Allocator_>::const_iterator x){
+		typename buffer::iterator value = other.values_.begin() + (x - other.values_.cbegin());
+		this->values_.insert(pos, std::move(*value));
+		other.values_.erase(value);
+}
+/*		@fn:        void splice(const_iterator pos, column_vector& other, const_iterator first, const_iterator last);
+*		@brief:		Moves the values in [FIRST, LAST) out of OTHER and in front of POS
+*		@pram:		const_iterator pos [in] value the moved values go in front of
+*					column_vector& other [in/out] column holding the range
+*					const_iterator first [in] first value to be moved
+*					const_iterator last [in] one past the last value to be moved
+*		@return:	void
+*		@pre:		The range must belong to OTHER, OTHER must not be this column.
+*		@post:		The values are moved in one block, iterators into OTHER at or after FIRST are invalidated*/
+template<typename T_, typename Allocator_>
+void column_vector<T_, Allocator_>::splice(typename column_vector<T_, Allocator_>::const_iterator pos, column_vector<T_, Allocator_>& other, typename column_vector<T_, Allocator_>::const_iterator first, typename column_vector<T_, Allocator_>::const_iterator last){
+		typename buffer::iterator from = other.values_.begin() + (first - other.values_.cbegin());
+		typename buffer::iterator to = other.values_.begin() + (last - other.values_.cbegin());
+		this->values_.insert(pos, std::make_move_iterator(from), std::make_move_iterator(to));
+		other.values_.erase(from, to);
+}
+#endif
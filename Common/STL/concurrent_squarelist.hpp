@@ -0,0 +1,18 @@
+#if !defined(GUARD_STL_CONCURRENT_SQUARELIST_HPP_)
+#define GUARD_STL_CONCURRENT_SQUARELIST_HPP_
+
+/** @file: concurrent_squarelist.hpp
+@author Robbie Brandrick
+@author r_brandrick@fanshaweonline.ca
+@date 2012-02-24
+@version 0.1.0
+@note Targets Visual C++ 10.0
+@briefs concurrent_squarelist, the STL squarelist shared between threads.
+		The locking lives in basic_concurrent_squarelist, this header only supplies the STL defaults*/
+
+#include "squarelist.hpp"
+#include "../basic_concurrent_squarelist.hpp"
+
+template<typename T_, typename Compare_ = std::less<T_>, typename Allocator_ = std::allocator<T_>, typename Column_ = std::list<T_, Allocator_>>
+using concurrent_squarelist = basic_concurrent_squarelist<squarelist<T_, Compare_, Allocator_, Column_>>;
+#endif
@@ -0,0 +1,324 @@
+#if !defined(GUARD_BASIC_CONCURRENT_SQUARELIST_HPP_)
+#define GUARD_BASIC_CONCURRENT_SQUARELIST_HPP_
+
+/** @file: basic_concurrent_squarelist.hpp
+@author Robbie Brandrick
+@author r_brandrick@fanshaweonline.ca
+@date 2012-02-24
+@version 0.1.0
+@note Targets Visual C++ 10.0
+@briefs basic_concurrent_squarelist class declaration and implementation, a square list shared between threads.
+		Any number of threads may read at once, a writer holds the list alone.
+		Only the container's public members are used, so the STL and Non-STL square lists share this class
+		and their concurrent_squarelist headers only pick the container.
+		Reads go through the container's const members only, which write nothing, so readers
+		share the lock's cache line and nothing else. A waiting writer goes ahead of new readers,
+		which sleep until no writer is waiting.
+		Results of read and write are values computed from the list, never the list or a reference into it
+@invariant the container is only written while the lock is held exclusively*/
+
+#include <shared_mutex>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+template<typename Container_>
+class basic_concurrent_squarelist{
+public:
+	typedef Container_									container_type;
+	typedef typename container_type::size_type			size_type;
+	typedef typename container_type::value_type			value_type;
+	typedef typename container_type::const_reference	const_reference;
+	typedef typename container_type::key_compare		key_compare;
+	typedef typename container_type::allocator_type		allocator_type;
+
+	basic_concurrent_squarelist() : writers_(0){}
+	explicit basic_concurrent_squarelist(key_compare const& comp, allocator_type const& alloc = allocator_type()) : writers_(0), list_(comp, alloc){}
+
+	bool contains(const_reference x) const;
+	size_type count(const_reference x) const;
+	size_type rank(const_reference x) const;
+	size_type size() const;
+	bool empty() const;
+	bool nth(size_type index, value_type& value) const;
+	template<typename Function>
+	void for_each(Function f) const;
+	template<typename Function>
+	void for_each(const_reference lo, const_reference hi, Function f) const;
+	template<typename Function>
+	auto read(Function f) const -> decltype(f(std::declval<container_type const&>()));
+
+	void insert(const_reference x);
+	void insert(value_type&& x);
+	template<typename... Args>
+	void emplace(Args&&... args);
+	template<typename InputIterator>
+	void insert(InputIterator first, InputIterator last);
+	bool erase(const_reference x);
+	size_type erase_range(const_reference lo, const_reference hi);
+	void clear();
+	template<typename Function>
+	auto write(Function f) -> decltype(f(std::declval<container_type&>()));
+private:
+	basic_concurrent_squarelist(basic_concurrent_squarelist const&);
+	basic_concurrent_squarelist& operator=(basic_concurrent_squarelist const&);
+
+	typedef std::shared_lock<std::shared_mutex>	read_lock;
+	typedef std::unique_lock<std::shared_mutex>	write_lock;
+
+	mutable std::shared_mutex	mutex_;
+	std::atomic<unsigned>		writers_;
+	mutable std::mutex			gate_;
+	mutable std::condition_variable	writersDone_;
+	container_type				list_;
+
+	read_lock lockRead() const;
+	write_lock lockWrite();
+};
+/*		@fn:		bool contains(const_reference x) const
+*		@brief:		Checks if the list holds X
+*		@pram:		const_reference x [in] value to be searched for
+*		@return:	bool true if X is in the list
+*		@pre:		none.
+*		@post:		The lock is shared with other readers while the list is searched*/
+template<typename Container_>
+bool basic_concurrent_squarelist<Container_>::contains(const_reference x) const{
+	read_lock lock = lockRead();
+	return list_.contains(x);
+}
+/*		@fn:		size_type count(const_reference x) const
+*		@brief:		Counts the values equal to X
+*		@pram:		const_reference x [in] value to be counted
+*		@return:	size_type number of values equal to X
+*		@pre:		none.
+*		@post:		The lock is shared with other readers while the list is searched*/
+template<typename Container_>
+typename basic_concurrent_squarelist<Container_>::size_type basic_concurrent_squarelist<Container_>::count(const_reference x) const{
+	read_lock lock = lockRead();
+	return list_.count(x);
+}
+/*		@fn:		size_type rank(const_reference x) const
+*		@brief:		Counts the values less than X
+*		@pram:		const_reference x [in] value to be ranked
+*		@return:	size_type number of values less than X
+*		@pre:		none.
+*		@post:		The lock is shared with other readers while the list is searched*/
+template<typename Container_>
+typename basic_concurrent_squarelist<Container_>::size_type basic_concurrent_squarelist<Container_>::rank(const_reference x) const{
+	read_lock lock = lockRead();
+	return list_.rank(x);
+}
+/*		@fn:		size_type size() const
+*		@brief:		Returns the number of values in the list
+*		@pram:		none.
+*		@return:	size_type number of values, a writer may change it as soon as it is returned
+*		@pre:		none.
+*		@post:		none.*/
+template<typename Container_>
+typename basic_concurrent_squarelist<Container_>::size_type basic_concurrent_squarelist<Container_>::size() const{
+	read_lock lock = lockRead();
+	return list_.size();
+}
+/*		@fn:		bool empty() const
+*		@brief:		Checks if the list holds no values
+*		@pram:		none.
+*		@return:	bool true if the list is empty, a writer may change it as soon as it is returned
+*		@pre:		none.
+*		@post:		none.*/
+template<typename Container_>
+bool basic_concurrent_squarelist<Container_>::empty() const{
+	read_lock lock = lockRead();
+	return list_.size() == 0;
+}
+/*		@fn:		bool nth(size_type index, value_type& value) const
+*		@brief:		Copies out the value at INDEX in sorted order
+*		@pram:		size_type index [in] position of the value
+*					value_type& value [out] copy of the value
+*		@return:	bool false if INDEX is past the end, VALUE is then untouched
+*		@pre:		none.
+*		@post:		The value is copied while the lock is held, so no reference into the list escapes it*/
+template<typename Container_>
+bool basic_concurrent_squarelist<Container_>::nth(size_type index, value_type& value) const{
+	read_lock lock = lockRead();
+	if(index >= list_.size())
+		return false;
+	value = list_[index];
+	return true;
+}
+/*		@fn:		void for_each(Function f) const
+*		@brief:		Calls F on every value in sorted order
+*		@pram:		Function f [in] called with a const_reference to each value
+*		@return:	void.
+*		@pre:		F must not call members of this list, it would deadlock.
+*		@post:		Writers wait until the walk is over, other readers do not*/
+template<typename Container_>
+template<typename Function>
+void basic_concurrent_squarelist<Container_>::for_each(Function f) const{
+	read_lock lock = lockRead();
+	for(typename container_type::const_iterator iter = list_.cbegin(); iter != list_.cend(); ++iter)
+		f(*iter);
+}
+/*		@fn:		void for_each(const_reference lo, const_reference hi, Function f) const
+*		@brief:		Calls F on every value not less than LO and less than HI in sorted order
+*		@pram:		const_reference lo [in] smallest value to visit
+*					const_reference hi [in] first value not to visit
+*					Function f [in] called with a const_reference to each value
+*		@return:	void.
+*		@pre:		F must not call members of this list, it would deadlock.
+*		@post:		Writers wait until the walk is over, other readers do not*/
+template<typename Container_>
+template<typename Function>
+void basic_concurrent_squarelist<Container_>::for_each(const_reference lo, const_reference hi, Function f) const{
+	read_lock lock = lockRead();
+	typename container_type::const_iterator last = list_.lower_bound(hi);
+	for(typename container_type::const_iterator iter = list_.lower_bound(lo); iter != last; ++iter)
+		f(*iter);
+}
+/*		@fn:		auto read(Function f) const
+*		@brief:		Calls F with the whole list for reads the other members do not cover
+*		@pram:		Function f [in] called with a container_type const&
+*		@return:	whatever F returns, neither a reference nor a copy of the list, either would outlive the lock
+*		@pre:		F must not call members of this list or keep an iterator or reference to the list past its return.
+*		@post:		The lock is shared with other readers while F runs*/
+template<typename Container_>
+template<typename Function>
+auto basic_concurrent_squarelist<Container_>::read(Function f) const -> decltype(f(std::declval<container_type const&>())){
+	typedef decltype(f(std::declval<container_type const&>())) result_type;
+	static_assert(!std::is_reference<result_type>::value, "read must not return a reference, it would outlive the lock");
+	static_assert(!std::is_same<typename std::decay<result_type>::type, container_type>::value, "read must not return the list, copy out the values needed instead");
+	read_lock lock = lockRead();
+	return f(static_cast<container_type const&>(list_));
+}
+/*		@fn:		void insert(const_reference x)
+*		@brief:		Inserts X in sorted order
+*		@pram:		const_reference x [in] value to be added
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The lock is held alone while the list is written*/
+template<typename Container_>
+void basic_concurrent_squarelist<Container_>::insert(const_reference x){
+	write_lock lock = lockWrite();
+	list_.insert(x);
+}
+/*		@fn:		void insert(value_type&& x)
+*		@brief:		Moves X into the list in sorted order
+*		@pram:		value_type&& x [in] value to be moved in
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The lock is held alone while the list is written*/
+template<typename Container_>
+void basic_concurrent_squarelist<Container_>::insert(value_type&& x){
+	write_lock lock = lockWrite();
+	list_.insert(std::move(x));
+}
+/*		@fn:		void emplace(Args&&... args)
+*		@brief:		Constructs a value and moves it into the list in sorted order
+*		@pram:		Args&&... args [in] arguments forwarded to the value's constructor
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The value is built before the lock is taken, so the lock is only held for the insert*/
+template<typename Container_>
+template<typename... Args>
+void basic_concurrent_squarelist<Container_>::emplace(Args&&... args){
+	value_type value(std::forward<Args>(args)...);
+	write_lock lock = lockWrite();
+	list_.insert(std::move(value));
+}
+/*		@fn:		void insert(InputIterator first, InputIterator last)
+*		@brief:		Inserts a range of values in one pass
+*		@pram:		InputIterator first [in] first value to be inserted
+*					InputIterator last [in] one past the last value to be inserted
+*		@return:	void.
+*		@pre:		The range must not be read from this list.
+*		@post:		The lock is held alone while the batch is merged in*/
+template<typename Container_>
+template<typename InputIterator>
+void basic_concurrent_squarelist<Container_>::insert(InputIterator first, InputIterator last){
+	write_lock lock = lockWrite();
+	list_.insert(first, last);
+}
+/*		@fn:		bool erase(const_reference x)
+*		@brief:		Erases one value equal to X
+*		@pram:		const_reference x [in] value to be erased
+*		@return:	bool indicating if a value was erased
+*		@pre:		none.
+*		@post:		The lock is held alone while the list is written*/
+template<typename Container_>
+bool basic_concurrent_squarelist<Container_>::erase(const_reference x){
+	write_lock lock = lockWrite();
+	return list_.erase(x);
+}
+/*		@fn:		size_type erase_range(const_reference lo, const_reference hi)
+*		@brief:		Erases every value not less than LO and less than HI
+*		@pram:		const_reference lo [in] smallest value to be erased
+*					const_reference hi [in] first value to be kept
+*		@return:	size_type number of values erased
+*		@pre:		none.
+*		@post:		The lock is held alone while the list is written*/
+template<typename Container_>
+typename basic_concurrent_squarelist<Container_>::size_type basic_concurrent_squarelist<Container_>::erase_range(const_reference lo, const_reference hi){
+	write_lock lock = lockWrite();
+	return list_.erase_range(lo, hi);
+}
+/*		@fn:		void clear()
+*		@brief:		Erases every value
+*		@pram:		none.
+*		@return:	void.
+*		@pre:		none.
+*		@post:		The lock is held alone while the list is written*/
+template<typename Container_>
+void basic_concurrent_squarelist<Container_>::clear(){
+	write_lock lock = lockWrite();
+	list_.clear();
+}
+/*		@fn:		auto write(Function f)
+*		@brief:		Calls F with the whole list for writes the other members do not cover
+*		@pram:		Function f [in] called with a container_type&
+*		@return:	whatever F returns, neither a reference nor a copy of the list, either would outlive the lock
+*		@pre:		F must not call members of this list or keep an iterator or reference to the list past its return.
+*		@post:		The lock is held alone while F runs, so several changes are seen by readers at once*/
+template<typename Container_>
+template<typename Function>
+auto basic_concurrent_squarelist<Container_>::write(Function f) -> decltype(f(std::declval<container_type&>())){
+	typedef decltype(f(std::declval<container_type&>())) result_type;
+	static_assert(!std::is_reference<result_type>::value, "write must not return a reference, it would outlive the lock");
+	static_assert(!std::is_same<typename std::decay<result_type>::type, container_type>::value, "write must not return the list, copy out the values needed instead");
+	write_lock lock = lockWrite();
+	return f(list_);
+}
+/*		@fn:		read_lock lockRead() const
+*		@brief:		Takes the lock shared with other readers
+*		@pram:		none.
+*		@return:	read_lock holding the lock until it is destroyed
+*		@pre:		The calling thread must not hold the lock.
+*		@post:		No writer is in the list. Readers sleep on the gate while a writer is waiting,
+*					so a steady stream of readers cannot starve it. While no writer waits the check only reads*/
+template<typename Container_>
+typename basic_concurrent_squarelist<Container_>::read_lock basic_concurrent_squarelist<Container_>::lockRead() const{
+	if(writers_.load(std::memory_order_relaxed) != 0){
+		std::unique_lock<std::mutex> gate(gate_);
+		writersDone_.wait(gate, [this](){ return writers_.load(std::memory_order_relaxed) == 0; });
+	}
+	return read_lock(mutex_);
+}
+/*		@fn:		write_lock lockWrite()
+*		@brief:		Takes the lock alone
+*		@pram:		none.
+*		@return:	write_lock holding the lock until it is destroyed
+*		@pre:		The calling thread must not hold the lock.
+*		@post:		No reader or other writer is in the list. The last waiting writer to get in wakes the readers
+*					held at the gate, they then wait on the lock until it is done*/
+template<typename Container_>
+typename basic_concurrent_squarelist<Container_>::write_lock basic_concurrent_squarelist<Container_>::lockWrite(){
+	writers_.fetch_add(1, std::memory_order_relaxed);
+	write_lock lock(mutex_);
+	if(writers_.fetch_sub(1, std::memory_order_relaxed) == 1){
+		//taking the gate orders the wake after any reader that saw a writer has started to wait
+		std::lock_guard<std::mutex> gate(gate_);
+		writersDone_.notify_all();
+	}
+	return lock;
+}
+#endif
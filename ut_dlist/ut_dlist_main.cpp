@@ -20,9 +20,13 @@
 #include <string>
 #include <random>
 #include <ctime>
+#include <cstdint>
 using namespace std;
 //include dlist library
 #include "../Common/Non-STL/dlist.hpp"
+#include "../Common/Non-STL/node_pool.hpp"
+#include "../Common/Non-STL/compact_dlist.hpp"
+#include "../Common/Non-STL/unrolled_dlist.hpp"
 
 /*Test the default constructor*/
 BOOST_AUTO_TEST_CASE(default_constructor){
@@ -846,3 +850,418 @@ BOOST_AUTO_TEST_CASE(general_test){
 	BOOST_CHECK(dlComplex.size() == 4000);
 }
 
+
+/* Counts the copies made of a value so the move paths can be checked*/
+struct copy_counter{
+	static unsigned copies;
+	int value;
+	copy_counter() : value(0){}
+	copy_counter(int v) : value(v){}
+	copy_counter(int v, int offset) : value(v + offset){}
+	copy_counter(copy_counter const& rhs) : value(rhs.value){ ++copies; }
+	copy_counter(copy_counter && rhs) : value(rhs.value){}
+	copy_counter& operator=(copy_counter const& rhs){ value = rhs.value; ++copies; return *this; }
+	copy_counter& operator=(copy_counter && rhs){ value = rhs.value; return *this; }
+};
+unsigned copy_counter::copies = 0;
+bool operator==(copy_counter const& lhs, copy_counter const& rhs){ return lhs.value == rhs.value; }
+
+/* Test that rvalues and emplaced values are never copied*/
+BOOST_AUTO_TEST_CASE(move_and_emplace){
+	dlist<copy_counter> list;
+	copy_counter::copies = 0;
+
+	copy_counter value(2);
+	list.push_back(std::move(value));
+	list.push_front(copy_counter(1));
+	list.emplace_back(4);
+	list.emplace_front(-1, 1);
+	dlist<copy_counter>::iterator it = list.end();
+	--it;
+	list.insert(it, copy_counter(3));
+	list.emplace(list.end(), 5);
+	BOOST_CHECK(copy_counter::copies == 0);
+
+	BOOST_CHECK(list.size() == 6);
+	int expected = 0;
+	for(it = list.begin(); it != list.end(); ++it)
+		BOOST_CHECK((*it).value == expected++);
+
+	list.push_back(value);
+	BOOST_CHECK(copy_counter::copies == 1);
+}
+
+/* Allocator that counts the blocks it has handed out and not yet taken back*/
+long allocated_blocks = 0;
+template<typename T_>
+struct counting_allocator{
+	typedef T_ value_type;
+	counting_allocator(){}
+	template<typename U_> counting_allocator(counting_allocator<U_> const&){}
+	T_* allocate(std::size_t n){ ++allocated_blocks; return static_cast<T_*>(::operator new(n * sizeof(T_))); }
+	void deallocate(T_* p, std::size_t){ --allocated_blocks; ::operator delete(p); }
+};
+template<typename T_, typename U_>
+bool operator==(counting_allocator<T_> const&, counting_allocator<U_> const&){ return true; }
+template<typename T_, typename U_>
+bool operator!=(counting_allocator<T_> const&, counting_allocator<U_> const&){ return false; }
+
+/* Test that every node of the dlist comes from and goes back to its allocator*/
+BOOST_AUTO_TEST_CASE(custom_allocator){
+	{
+		dlist<int, counting_allocator<int>> list;
+		long empty = allocated_blocks;
+		for(int i = 0; i < NUM_NODES; i++)
+			list.push_back(i);
+		BOOST_CHECK(allocated_blocks == empty + NUM_NODES);
+
+		dlist<int, counting_allocator<int>> copy(list);
+		BOOST_CHECK(std::equal(list.begin(), list.end(), copy.begin()));
+		while(!list.empty())
+			list.pop_front();
+		BOOST_CHECK(allocated_blocks == 2 * empty + NUM_NODES);
+	}
+	BOOST_CHECK(allocated_blocks == 0);
+}
+
+/* Test that splicing relinks nodes without allocating them*/
+BOOST_AUTO_TEST_CASE(splice_nodes){
+	dlist<int, counting_allocator<int>> lhs, rhs;
+	list<int> expectedLhs, expectedRhs;
+	for(int i = 0; i < 10; i++){
+		lhs.push_back(i);
+		rhs.push_back(i + 10);
+		expectedLhs.push_back(i);
+		expectedRhs.push_back(i + 10);
+	}
+	long blocks = allocated_blocks;
+	int* moved = &rhs.front();
+
+	//single node
+	lhs.splice(lhs.begin(), rhs, rhs.begin());
+	expectedLhs.splice(expectedLhs.begin(), expectedRhs, expectedRhs.begin());
+	BOOST_CHECK(&lhs.front() == moved);
+
+	//range, between two lists and within one list
+	dlist<int, counting_allocator<int>>::iterator first = rhs.begin(), last = rhs.end();
+	++first; --last;
+	list<int>::iterator efirst = expectedRhs.begin(), elast = expectedRhs.end();
+	++efirst; --elast;
+	lhs.splice(lhs.end(), rhs, first, last);
+	expectedLhs.splice(expectedLhs.end(), expectedRhs, efirst, elast);
+	first = lhs.begin(); ++first;
+	last = first; ++last; ++last;
+	lhs.splice(lhs.end(), lhs, first, last);
+	efirst = expectedLhs.begin(); ++efirst;
+	elast = efirst; ++elast; ++elast;
+	expectedLhs.splice(expectedLhs.end(), expectedLhs, efirst, elast);
+	BOOST_CHECK(lhs.size() == expectedLhs.size());
+	BOOST_CHECK(rhs.size() == expectedRhs.size());
+	BOOST_CHECK(std::equal(expectedLhs.begin(), expectedLhs.end(), lhs.begin()));
+	BOOST_CHECK(std::equal(expectedRhs.begin(), expectedRhs.end(), rhs.begin()));
+
+	//whole list
+	lhs.splice(lhs.begin(), rhs);
+	expectedLhs.splice(expectedLhs.begin(), expectedRhs);
+	BOOST_CHECK(rhs.empty());
+	BOOST_CHECK(lhs.size() == 20);
+	BOOST_CHECK(std::equal(expectedLhs.begin(), expectedLhs.end(), lhs.begin()));
+	BOOST_CHECK(std::equal(expectedLhs.rbegin(), expectedLhs.rend(), lhs.rbegin()));
+	BOOST_CHECK(allocated_blocks == blocks);
+}
+
+/* Test that a pooled dlist reuses freed nodes and gives its slabs back in bulk*/
+BOOST_AUTO_TEST_CASE(pooled_nodes){
+	std::shared_ptr<node_pool> pool = std::make_shared<node_pool>();
+	{
+		dlist<int, pool_allocator<int>> list((pool_allocator<int>(pool)));
+		for(int i = 0; i < NUM_NODES; i++)
+			list.push_back(i);
+		BOOST_CHECK(pool->live() == NUM_NODES + 1);
+		//slabs double in size so only a handful are needed
+		BOOST_CHECK(pool->slabs() < 10);
+
+		int* freed = &list.back();
+		list.pop_back();
+		list.push_front(-1);
+		BOOST_CHECK(&list.front() == freed);
+
+		dlist<int, pool_allocator<int>> copy(list);
+		BOOST_CHECK(copy.get_allocator() == list.get_allocator());
+		BOOST_CHECK(pool->live() == 2 * (NUM_NODES + 1));
+		list.clear();
+		BOOST_CHECK(pool->live() == NUM_NODES + 2);
+	}
+	BOOST_CHECK(pool->live() == 0);
+	std::size_t slabs = pool->slabs();
+	dlist<int, pool_allocator<int>> reuse((pool_allocator<int>(pool)));
+	for(int i = 0; i < NUM_NODES; i++)
+		reuse.push_back(i);
+	BOOST_CHECK(pool->slabs() == slabs);
+}
+
+/* Test that dlist nodes carry no vtable and compact nodes are linked by 32 bit indices*/
+BOOST_AUTO_TEST_CASE(slim_nodes){
+	//no vtable, a node is the value and its two links
+	BOOST_CHECK(sizeof(dlist_node<int>) < sizeof(int) + 3 * sizeof(void*));
+	BOOST_CHECK(sizeof(compact_dlist_node<int>) == sizeof(int) + 2 * sizeof(std::uint32_t));
+}
+
+/* Test a compact_dlist against std::list, including growing, reusing and splicing its nodes*/
+BOOST_AUTO_TEST_CASE(compact_nodes){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	compact_dlist<int> list;
+	std::list<int> history;
+	for(int i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		if(value % 2){
+			list.push_back(value);
+			history.push_back(value);
+		} else {
+			list.push_front(value);
+			history.push_front(value);
+		}
+	}
+	BOOST_CHECK(list.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), list.begin()));
+	BOOST_CHECK(std::equal(history.rbegin(), history.rend(), list.rbegin()));
+
+	//iterators are indices so they survive the node array growing
+	compact_dlist<int>::iterator kept = list.begin();
+	int keptValue = *kept;
+	list.reserve(list.capacity() * 4);
+	BOOST_CHECK(*kept == keptValue);
+
+	compact_dlist<int>::iterator listIter = list.begin();
+	std::list<int>::iterator historyIter = history.begin();
+	while(listIter != list.end()){
+		if(*listIter % 3 == 0){
+			listIter = list.erase(listIter);
+			historyIter = history.erase(historyIter);
+		} else {
+			++listIter;
+			++historyIter;
+		}
+	}
+	BOOST_CHECK(std::equal(history.begin(), history.end(), list.begin()));
+
+	//freed nodes are reused before the array grows
+	std::size_t capacity = list.capacity();
+	while(list.size() < capacity){
+		list.push_back(list.front());
+		history.push_back(history.front());
+	}
+	BOOST_CHECK(list.capacity() == capacity);
+	BOOST_CHECK(std::equal(history.begin(), history.end(), list.begin()));
+
+	compact_dlist<int> copy(list);
+	BOOST_CHECK(std::equal(history.begin(), history.end(), copy.begin()));
+	compact_dlist<int> other;
+	other.splice(other.end(), copy, copy.begin(), ++++copy.begin());
+	other.splice(other.begin(), copy, --copy.end());
+	BOOST_CHECK(copy.size() + other.size() == list.size());
+	BOOST_CHECK(other.back() == *++history.begin());
+	BOOST_CHECK(other.front() == history.back());
+	copy.splice(copy.begin(), copy, --copy.end());
+	BOOST_CHECK(copy.front() == *----history.end());
+
+	//a moved from list is left empty, not without a node array
+	compact_dlist<int> moved(std::move(copy));
+	BOOST_CHECK(copy.empty());
+	BOOST_CHECK(copy.begin() == copy.end());
+	copy.push_back(7);
+	BOOST_CHECK(copy.front() == 7 && copy.back() == 7);
+	moved = std::move(copy);
+	BOOST_CHECK(moved.size() == 1 && moved.front() == 7);
+	BOOST_CHECK(copy.begin() == copy.end());
+	copy.push_front(8);
+	BOOST_CHECK(copy.front() == 8);
+
+	list.clear();
+	BOOST_CHECK(list.empty());
+	BOOST_CHECK(list.begin() == list.end());
+}
+
+/* Test that the node array of a pooled compact_dlist comes from the pool and is reused once it is outgrown*/
+BOOST_AUTO_TEST_CASE(pooled_compact_nodes){
+	std::shared_ptr<node_pool> pool = std::make_shared<node_pool>();
+	{
+		compact_dlist<int, pool_allocator<int>> list((pool_allocator<int>(pool)));
+		for(int i = 0; i < NUM_NODES; i++)
+			list.push_back(i);
+		//only the node array is live, every array it outgrew is back on the pool's free lists
+		BOOST_CHECK(pool->live() == 1);
+		std::size_t slabs = pool->slabs();
+		{
+			compact_dlist<int, pool_allocator<int>> other((pool_allocator<int>(pool)));
+			for(int i = 0; i < NUM_NODES / 2; i++)
+				other.push_back(i);
+			BOOST_CHECK(pool->live() == 2);
+			BOOST_CHECK(pool->slabs() == slabs);
+		}
+		int expected = 0;
+		for(compact_dlist<int, pool_allocator<int>>::iterator iter = list.begin(); iter != list.end(); ++iter)
+			BOOST_CHECK(*iter == expected++);
+	}
+	BOOST_CHECK(pool->live() == 0);
+}
+
+struct alignas(64) wide_value{
+	int value_;
+	wide_value(int value = 0) : value_(value){}
+	bool operator==(wide_value const& rhs) const{return value_ == rhs.value_;}
+};
+template<typename List_>
+bool aligned_values(List_ const& list){
+	for(typename List_::const_iterator iter = list.begin(); iter != list.end(); ++iter)
+		if(reinterpret_cast<std::uintptr_t>(&*iter) % alignof(wide_value) != 0)
+			return false;
+	return true;
+}
+/* Test that pooled lists of an over aligned type keep every value on its alignment*/
+BOOST_AUTO_TEST_CASE(over_aligned_nodes){
+	std::shared_ptr<node_pool> pool = std::make_shared<node_pool>();
+	dlist<wide_value, pool_allocator<wide_value>> list((pool_allocator<wide_value>(pool)));
+	compact_dlist<wide_value, pool_allocator<wide_value>> compact((pool_allocator<wide_value>(pool)));
+	unrolled_dlist<wide_value, pool_allocator<wide_value>> unrolled((pool_allocator<wide_value>(pool)));
+	for(int i = 0; i < NUM_NODES; i++){
+		list.push_back(i);
+		compact.push_back(i);
+		unrolled.push_back(i);
+	}
+	BOOST_CHECK(aligned_values(list));
+	BOOST_CHECK(aligned_values(compact));
+	BOOST_CHECK(aligned_values(unrolled));
+	BOOST_CHECK(list.back().value_ == NUM_NODES - 1 && compact.back().value_ == NUM_NODES - 1 && unrolled.back().value_ == NUM_NODES - 1);
+	//over aligned nodes are not pooled
+	BOOST_CHECK(pool->live() == 0);
+}
+
+/* Test that splicing between lists on different pools moves the values instead of relinking the nodes*/
+BOOST_AUTO_TEST_CASE(splice_between_pools){
+	std::shared_ptr<node_pool> pool = std::make_shared<node_pool>();
+	std::shared_ptr<node_pool> otherPool = std::make_shared<node_pool>();
+	dlist<int, pool_allocator<int>> list((pool_allocator<int>(pool)));
+	for(int i = 0; i < NUM_NODES; i++)
+		list.push_back(i);
+	{
+		dlist<int, pool_allocator<int>> other((pool_allocator<int>(otherPool)));
+		for(int i = 0; i < NUM_NODES; i++)
+			other.push_back(NUM_NODES + i);
+		//nodes can not be relinked into a list whose allocator can not free them
+		list.splice(list.end(), other, other.begin());
+		list.splice(list.end(), other, other.begin(), ++++other.begin());
+		list.splice(list.end(), other);
+		BOOST_CHECK(other.empty());
+		BOOST_CHECK(otherPool->live() == 1);
+	}
+	BOOST_CHECK(otherPool->live() == 0);
+	BOOST_CHECK(pool->live() == 2 * NUM_NODES + 1);
+	BOOST_CHECK(list.size() == 2 * NUM_NODES);
+	int expected = 0;
+	for(dlist<int, pool_allocator<int>>::iterator iter = list.begin(); iter != list.end(); ++iter)
+		BOOST_CHECK(*iter == expected++);
+}
+
+/* Test an unrolled_dlist against std::list, with nodes that each hold a cache line of values*/
+BOOST_AUTO_TEST_CASE(unrolled_nodes){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	//a node fills a cache line
+	BOOST_CHECK(sizeof(unrolled_dlist_node<int>) == 64);
+	BOOST_CHECK(unrolled_dlist<int>::node_capacity > 1);
+
+	unrolled_dlist<int> list;
+	std::list<int> history;
+	for(int i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		if(value % 2){
+			list.push_back(value);
+			history.push_back(value);
+		} else {
+			list.push_front(value);
+			history.push_front(value);
+		}
+	}
+	BOOST_CHECK(list.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), list.begin()));
+	BOOST_CHECK(std::equal(history.rbegin(), history.rend(), list.rbegin()));
+
+	//inserts in the middle split full nodes
+	unrolled_dlist<int>::iterator listIter = list.begin();
+	std::list<int>::iterator historyIter = history.begin();
+	while(listIter != list.end()){
+		if(*listIter % 5 == 0){
+			listIter = ++list.insert(listIter, -*listIter);
+			historyIter = ++history.insert(historyIter, -*historyIter);
+		}
+		++listIter;
+		++historyIter;
+	}
+	BOOST_CHECK(std::equal(history.begin(), history.end(), list.begin()));
+
+	listIter = list.begin();
+	historyIter = history.begin();
+	while(listIter != list.end()){
+		if(*listIter % 3 == 0){
+			listIter = list.erase(listIter);
+			historyIter = history.erase(historyIter);
+		} else {
+			++listIter;
+			++historyIter;
+		}
+	}
+	BOOST_CHECK(list.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), list.begin()));
+
+	unrolled_dlist<int> copy(list);
+	unrolled_dlist<int> other;
+	std::list<int> otherHistory;
+	unrolled_dlist<int>::iterator first = copy.begin();
+	std::advance(first, 3);
+	unrolled_dlist<int>::iterator last = first;
+	std::advance(last, NUM_NODES / 4);
+	other.splice(other.end(), copy, first, last);
+	std::list<int>::iterator from = history.begin();
+	std::advance(from, 3);
+	std::list<int>::iterator to = from;
+	std::advance(to, NUM_NODES / 4);
+	otherHistory.splice(otherHistory.end(), history, from, to);
+	BOOST_CHECK(copy.size() == history.size());
+	BOOST_CHECK(other.size() == otherHistory.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), copy.begin()));
+	BOOST_CHECK(std::equal(otherHistory.begin(), otherHistory.end(), other.begin()));
+
+	other.splice(other.begin(), copy, --copy.end());
+	otherHistory.splice(otherHistory.begin(), history, --history.end());
+	copy.splice(++copy.begin(), copy, --copy.end());
+	history.splice(++history.begin(), history, --history.end());
+	copy.splice(copy.end(), other);
+	history.splice(history.end(), otherHistory);
+	BOOST_CHECK(other.empty());
+	BOOST_CHECK(copy.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), copy.begin()));
+	BOOST_CHECK(std::equal(history.rbegin(), history.rend(), copy.rbegin()));
+
+	while(!copy.empty()){
+		BOOST_CHECK(copy.front() == history.front());
+		copy.pop_front();
+		history.pop_front();
+	}
+	BOOST_CHECK(copy.begin() == copy.end());
+
+	unrolled_dlist<int, pool_allocator<int>> pooled;
+	unrolled_dlist<int, pool_allocator<int>> otherPooled;
+	for(int i = 0; i < NUM_NODES; i++)
+		otherPooled.push_back(i);
+	pooled.splice(pooled.end(), otherPooled);
+	BOOST_CHECK(otherPooled.empty());
+	BOOST_CHECK(otherPooled.get_allocator().pool()->live() == 1);
+	BOOST_CHECK(pooled.size() == NUM_NODES);
+	BOOST_CHECK(pooled.back() == NUM_NODES - 1);
+}
@@ -16,14 +16,20 @@
 
 //stl
 #include <list>
+#include <set>
+#include <vector>
 #include <algorithm>
+#include <functional>
 #include <string>
 #include <random>
 #include <ctime>
 #include <iostream>
+#include <thread>
+#include <atomic>
 using namespace std;
 //include squarelist library
 #include "../Common/STL/squarelist.hpp"
+#include "../Common/STL/concurrent_squarelist.hpp"
 
 /* Test insert method with sequential unsigned data*/
 BOOST_AUTO_TEST_CASE(insert_sequential_numbers){
@@ -482,4 +488,899 @@ BOOST_AUTO_TEST_CASE(different_iterator){
 	//slist2.erase(iter1);
 	slist.erase(iter1);
 	slist2.erase(iter2);
-}
\ No newline at end of file
+}
+/* Test insert lands in the right vertical list when the value falls between,
+ * or on the boundary of, existing vertical lists*/
+BOOST_AUTO_TEST_CASE(insert_between_vertical_lists){
+	squarelist<int> slist;
+	std::list<int> history;
+	for(int i = 0; i < NUM_NODES; i += 2){
+		slist.insert(i);
+		history.push_back(i);
+	}
+
+	for(int i = NUM_NODES - 1; i > 0; i -= 2){
+		slist.insert(i);
+		slist.insert(i - 1);
+		slist.insert(-i);
+		history.push_back(i);
+		history.push_back(i - 1);
+		history.push_back(-i);
+	}
+
+	history.sort();
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+}
+
+/* Test that balancing only moves values between the vertical lists it has to,
+ * never more than one value per vertical list on insert*/
+BOOST_AUTO_TEST_CASE(insert_balance_is_local){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<unsigned int> valueDistribution(0,1024);
+
+	squarelist<unsigned> slist;
+	for(unsigned i = 1; i <= NUM_NODES; i++){
+		std::size_t shifts = slist.shifts();
+		slist.insert(valueDistribution(randomEngine));
+		std::size_t maxDepth = static_cast<std::size_t>(std::ceil(std::sqrt( i * 1.0 )));
+		BOOST_CHECK(slist.shifts() - shifts <= maxDepth);
+	}
+
+	//erasing moves nothing until the max depth shrinks (1000 -> 961 values)
+	squarelist<unsigned> ordered;
+	for(unsigned i = 0; i < NUM_NODES; i++)
+		ordered.insert(i);
+	std::size_t shifts = ordered.shifts();
+	for(unsigned i = 0; i < NUM_NODES - 962; i++)
+		BOOST_CHECK(ordered.erase(i * 25));
+	BOOST_CHECK(ordered.shifts() == shifts);
+	BOOST_CHECK(ordered.erase(1));
+	BOOST_CHECK(ordered.size() == 961);
+	BOOST_CHECK(is_sorted(ordered.begin(), ordered.end()));
+}
+
+/* Test the lookup functions against std::multiset*/
+BOOST_AUTO_TEST_CASE(lookup_functions){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,256);
+
+	squarelist<int> slist;
+	multiset<int> history;
+	BOOST_CHECK(slist.find(1) == slist.end());
+	BOOST_CHECK(!slist.contains(1));
+	BOOST_CHECK(slist.count(1) == 0);
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.insert(value);
+	}
+
+	squarelist<int> const& cslist = slist;
+	for(int value = -1; value <= 257; value++){
+		BOOST_CHECK(slist.contains(value) == (history.count(value) != 0));
+		BOOST_CHECK(cslist.count(value) == history.count(value));
+		BOOST_CHECK(std::distance(slist.begin(), slist.lower_bound(value)) == std::distance(history.begin(), history.lower_bound(value)));
+		BOOST_CHECK(std::distance(cslist.begin(), cslist.upper_bound(value)) == std::distance(history.begin(), history.upper_bound(value)));
+
+		auto range = slist.equal_range(value);
+		BOOST_CHECK(std::distance(range.first, range.second) == (ptrdiff_t)history.count(value));
+		auto found = cslist.find(value);
+		if(history.count(value) == 0)
+			BOOST_CHECK(found == cslist.end());
+		else{
+			BOOST_CHECK(*found == value);
+			BOOST_CHECK(found == range.first);
+		}
+	}
+}
+
+/* Test that erasing values that are not in the square list leaves it untouched
+ * and that duplicates spanning vertical lists are erased one at a time*/
+BOOST_AUTO_TEST_CASE(erase_missing_values){
+	squarelist<int> slist;
+	BOOST_CHECK(!slist.erase(0));
+	for(int i = 0; i < (int)NUM_NODES; i++)
+		slist.insert(i * 2);
+
+	std::size_t shifts = slist.shifts();
+	for(int i = -1; i <= (int)NUM_NODES * 2; i += 2)
+		BOOST_CHECK(!slist.erase(i));
+	BOOST_CHECK(slist.size() == NUM_NODES);
+	BOOST_CHECK(slist.shifts() == shifts);
+
+	for(unsigned i = 0; i < 100; i++)
+		slist.insert(500);
+	for(unsigned i = 0; i < 101; i++)
+		BOOST_CHECK(slist.erase(500));
+	BOOST_CHECK(!slist.erase(500));
+	BOOST_CHECK(!slist.contains(500));
+	BOOST_CHECK(slist.size() == NUM_NODES - 1);
+	BOOST_CHECK(is_sorted(slist.begin(), slist.end()));
+}
+
+/* Test that erasing through an iterator returns the value that followed it,
+ * also when its vertical list empties or the square list is rebalanced*/
+BOOST_AUTO_TEST_CASE(erase_iterator_successor){
+	squarelist<int> slist;
+	list<int> history;
+	for(int i = 0; i < (int)NUM_NODES; i++){
+		slist.insert(i);
+		if(i % 3 == 0)
+			history.push_back(i);
+	}
+
+	for(auto iter = slist.begin(); iter != slist.end();){
+		if(*iter % 3 != 0)
+			iter = slist.erase(iter);
+		else
+			++iter;
+	}
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+
+	int expected = 0;
+	for(auto iter = slist.begin(); iter != slist.end(); expected += 3){
+		BOOST_CHECK(*iter == expected);
+		iter = slist.erase(iter);
+	}
+	BOOST_CHECK(slist.size() == 0);
+	BOOST_CHECK(slist.begin() == slist.end());
+}
+
+/* Test positional access by rank and random access iterator arithmetic*/
+BOOST_AUTO_TEST_CASE(random_access_by_rank){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	squarelist<int> slist;
+	vector<int> history;
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.push_back(value);
+	}
+	sort(history.begin(), history.end());
+
+	squarelist<int> const& cslist = slist;
+	BOOST_CHECK(slist.nth(NUM_NODES) == slist.end());
+	BOOST_CHECK(slist.end() - slist.begin() == (ptrdiff_t)NUM_NODES);
+	BOOST_CHECK(std::distance(cslist.begin(), cslist.end()) == (ptrdiff_t)NUM_NODES);
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		BOOST_CHECK(slist[i] == history[i]);
+		BOOST_CHECK(*slist.nth(i) == history[i]);
+		BOOST_CHECK(*cslist.nth(i) == history[i]);
+		BOOST_CHECK(*std::next(slist.begin(), i) == history[i]);
+		BOOST_CHECK(*std::prev(cslist.end(), NUM_NODES - i) == history[i]);
+		BOOST_CHECK(slist.nth(i) - slist.begin() == (ptrdiff_t)i);
+		BOOST_CHECK(slist.begin()[i] == history[i]);
+	}
+
+	auto iter = slist.begin();
+	for(unsigned step = 1, pos = 0; pos + step < NUM_NODES; pos += step, step++){
+		std::advance(iter, step);
+		BOOST_CHECK(*iter == history[pos + step]);
+		BOOST_CHECK(slist.begin() < iter);
+		BOOST_CHECK(*(iter - step) == history[pos]);
+	}
+	BOOST_CHECK(slist.begin() + NUM_NODES == slist.end());
+	BOOST_CHECK(slist.end() - (ptrdiff_t)NUM_NODES == slist.begin());
+}
+
+/* Test rank and index_of against a sorted vector*/
+BOOST_AUTO_TEST_CASE(rank_and_index_of){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,512);
+
+	squarelist<int> slist;
+	vector<int> history;
+	BOOST_CHECK(slist.rank(0) == 0);
+	BOOST_CHECK(slist.index_of(slist.end()) == 0);
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.push_back(value);
+	}
+	sort(history.begin(), history.end());
+
+	for(int value = -1; value <= 513; value++)
+		BOOST_CHECK(slist.rank(value) == (std::size_t)(std::lower_bound(history.begin(), history.end(), value) - history.begin()));
+
+	std::size_t index = 0;
+	for(auto iter = slist.begin(); iter != slist.end(); ++iter, ++index)
+		BOOST_CHECK(slist.index_of(iter) == index);
+	BOOST_CHECK(slist.index_of(slist.cend()) == NUM_NODES);
+	for(std::size_t i = 0; i < NUM_NODES; i += 7)
+		BOOST_CHECK(slist.index_of(slist.nth(i)) == i);
+}
+
+/* Test bulk loading a sorted range through the range constructor and assign*/
+BOOST_AUTO_TEST_CASE(bulk_load_sorted_range){
+	vector<int> values;
+	for(int i = 0; i < (int)NUM_NODES; i++)
+		values.push_back(i / 3);
+
+	for(std::size_t count = 0; count <= NUM_NODES; count += 37){
+		squarelist<int> slist(values.begin(), values.begin() + count);
+		BOOST_CHECK(slist.size() == count);
+		BOOST_CHECK(std::equal(values.begin(), values.begin() + count, slist.begin()));
+		BOOST_CHECK(slist.shifts() == 0);
+	}
+
+	squarelist<int> slist;
+	slist.insert(5000);
+	list<int> history(values.begin(), values.end());
+	slist.assign(history.begin(), history.end());
+	BOOST_CHECK(slist.size() == NUM_NODES);
+	BOOST_CHECK(!slist.contains(5000));
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+
+	slist.insert(-1);
+	history.push_front(-1);
+	BOOST_CHECK(slist.erase(100));
+	history.erase(std::find(history.begin(), history.end(), 100));
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+
+	slist.assign(values.end(), values.end());
+	BOOST_CHECK(slist.size() == 0);
+	BOOST_CHECK(slist.begin() == slist.end());
+	slist.insert(1);
+	BOOST_CHECK(slist.front() == 1);
+}
+
+/* Test inserting unsorted batches of values with one rebalance per batch*/
+BOOST_AUTO_TEST_CASE(insert_unsorted_batch){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,256);
+
+	squarelist<int> slist;
+	multiset<int> history;
+	vector<int> batch;
+	slist.insert(batch.begin(), batch.end());
+	BOOST_CHECK(slist.size() == 0);
+
+	for(unsigned round = 0; round < 10; round++){
+		batch.clear();
+		for(unsigned i = 0; i < NUM_NODES / 10 + round; i++)
+			batch.push_back(valueDistribution(randomEngine));
+		slist.insert(batch.begin(), batch.end());
+		history.insert(batch.begin(), batch.end());
+		BOOST_CHECK(slist.size() == history.size());
+		BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.insert(value);
+	}
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+}
+
+/* Test erasing ranges of values by iterator and by key bounds*/
+BOOST_AUTO_TEST_CASE(erase_ranges){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	squarelist<int> slist;
+	multiset<int> history;
+	for(unsigned i = 0; i < NUM_NODES * 2; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.insert(value);
+	}
+
+	while(slist.size() > 10){
+		uniform_int_distribution<std::size_t> indexDistribution(0, slist.size());
+		std::size_t lo = indexDistribution(randomEngine), hi = indexDistribution(randomEngine);
+		if(hi < lo)
+			std::swap(lo, hi);
+		hi = std::min(hi, lo + slist.size() / 3);
+		auto next = slist.erase(slist.nth(lo), slist.nth(hi));
+		auto first = std::next(history.begin(), lo);
+		history.erase(first, std::next(first, hi - lo));
+		BOOST_CHECK(slist.size() == history.size());
+		BOOST_CHECK(slist.index_of(next) == lo);
+		BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	}
+
+	slist.insert(history.begin(), history.end());
+	slist.insert(2000);
+	std::size_t count = slist.size();
+	BOOST_CHECK(slist.erase_range(2000, 0) == 0);
+	BOOST_CHECK(slist.erase_range(0, 2000) == count - 1);
+	BOOST_CHECK(slist.size() == 1);
+	BOOST_CHECK(slist.front() == 2000);
+	auto next = slist.erase(slist.begin(), slist.end());
+	BOOST_CHECK(next == slist.end());
+	BOOST_CHECK(slist.size() == 0);
+	slist.insert(7);
+	BOOST_CHECK(slist.front() == 7 && slist.back() == 7);
+}
+
+/* Test merging square lists by move and by copy*/
+BOOST_AUTO_TEST_CASE(merge_square_lists){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,512);
+
+	squarelist<int> slist, other;
+	multiset<int> history, otherHistory;
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.insert(value);
+		value = valueDistribution(randomEngine);
+		other.insert(value);
+		otherHistory.insert(value);
+	}
+
+	slist.merge(other);
+	history.insert(otherHistory.begin(), otherHistory.end());
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	BOOST_CHECK(other.size() == otherHistory.size());
+	BOOST_CHECK(std::equal(otherHistory.begin(), otherHistory.end(), other.begin()));
+
+	slist.merge(std::move(other));
+	history.insert(otherHistory.begin(), otherHistory.end());
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	BOOST_CHECK(other.size() == 0);
+	BOOST_CHECK(other.begin() == other.end());
+
+	squarelist<int> empty;
+	empty.merge(std::move(slist));
+	BOOST_CHECK(empty.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), empty.begin()));
+	empty.insert(-1);
+	BOOST_CHECK(empty.front() == -1);
+}
+
+/* Test splitting a square list at a key and joining the halves back*/
+BOOST_AUTO_TEST_CASE(split_and_join){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	squarelist<int> slist;
+	multiset<int> history;
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.insert(value);
+	}
+
+	for(int key = -1; key <= 1025; key += 37){
+		squarelist<int> upper = slist.split(key);
+		BOOST_CHECK(slist.size() + upper.size() == history.size());
+		BOOST_CHECK(std::equal(history.begin(), history.lower_bound(key), slist.begin()));
+		BOOST_CHECK(std::equal(history.lower_bound(key), history.end(), upper.begin()));
+		BOOST_CHECK(slist.size() == (std::size_t)std::distance(history.begin(), history.lower_bound(key)));
+
+		upper.insert(key);
+		slist.join(std::move(upper));
+		BOOST_CHECK(upper.size() == 0);
+		BOOST_CHECK(slist.erase(key));
+		BOOST_CHECK(slist.size() == history.size());
+		BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	}
+
+	squarelist<int> empty;
+	empty.join(slist.split(512));
+	BOOST_CHECK(std::equal(history.lower_bound(512), history.end(), empty.begin()));
+	empty.join(squarelist<int>());
+	BOOST_CHECK(empty.size() == (std::size_t)std::distance(history.lower_bound(512), history.end()));
+}
+
+/* Counts the copies made of a value so the move paths can be checked*/
+struct copy_counter{
+	static unsigned copies;
+	int value;
+	copy_counter() : value(0){}
+	copy_counter(int v) : value(v){}
+	copy_counter(int v, int offset) : value(v + offset){}
+	copy_counter(copy_counter const& rhs) : value(rhs.value){ ++copies; }
+	copy_counter(copy_counter && rhs) : value(rhs.value){}
+	copy_counter& operator=(copy_counter const& rhs){ value = rhs.value; ++copies; return *this; }
+	copy_counter& operator=(copy_counter && rhs){ value = rhs.value; return *this; }
+};
+unsigned copy_counter::copies = 0;
+bool operator<(copy_counter const& lhs, copy_counter const& rhs){ return lhs.value < rhs.value; }
+bool operator>(copy_counter const& lhs, copy_counter const& rhs){ return lhs.value > rhs.value; }
+bool operator<=(copy_counter const& lhs, copy_counter const& rhs){ return lhs.value <= rhs.value; }
+bool operator==(copy_counter const& lhs, copy_counter const& rhs){ return lhs.value == rhs.value; }
+
+/* Test that inserting rvalues and emplacing never copies a value, also while balancing*/
+BOOST_AUTO_TEST_CASE(move_and_emplace){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	squarelist<copy_counter> slist;
+	multiset<int> history;
+	copy_counter::copies = 0;
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		if(i % 2)
+			slist.insert(copy_counter(value));
+		else
+			slist.emplace(value - 1, 1);
+		history.insert(value);
+	}
+	BOOST_CHECK(copy_counter::copies == 0);
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin(),
+		[](int lhs, copy_counter const& rhs){ return lhs == rhs.value; }));
+
+	copy_counter value(7);
+	slist.insert(value);
+	BOOST_CHECK(copy_counter::copies == 1);
+}
+
+/* Test that erasing a range which shrinks the max depth lays the square list out again without copying a value*/
+BOOST_AUTO_TEST_CASE(erase_range_moves_values){
+	squarelist<copy_counter> slist;
+	for(int i = 0; i < NUM_NODES * 4; i++)
+		slist.insert(copy_counter(i));
+
+	//half the values go so every vertical list left is deeper than the new max depth
+	copy_counter::copies = 0;
+	squarelist<copy_counter>::iterator next = slist.erase(slist.nth(NUM_NODES), slist.nth(NUM_NODES * 3));
+	BOOST_CHECK(copy_counter::copies == 0);
+	BOOST_CHECK(slist.size() == NUM_NODES * 2);
+	BOOST_CHECK((*next).value == NUM_NODES * 3);
+	int expected = 0;
+	for(squarelist<copy_counter>::iterator iter = slist.begin(); iter != slist.end(); ++iter){
+		BOOST_CHECK((*iter).value == expected++);
+		if(expected == NUM_NODES)
+			expected = NUM_NODES * 3;
+	}
+
+	//vertical lists a copy still shares are read, never given up
+	squarelist<copy_counter> shared(slist);
+	shared.erase(shared.begin(), shared.nth(NUM_NODES * 3 / 2));
+	BOOST_CHECK(shared.size() == NUM_NODES / 2);
+	BOOST_CHECK(shared.front().value == NUM_NODES * 7 / 2);
+	BOOST_CHECK(slist.size() == NUM_NODES * 2);
+	BOOST_CHECK(slist.front().value == 0);
+	BOOST_CHECK((*slist.nth(NUM_NODES)).value == NUM_NODES * 3);
+}
+
+/* Test that squaring the halves up after a split and a join moves values instead of copying them*/
+BOOST_AUTO_TEST_CASE(split_and_join_move_values){
+	squarelist<copy_counter> slist;
+	for(int i = 0; i < NUM_NODES * 4; i++)
+		slist.insert(copy_counter(i));
+
+	//both halves and the joined list are deeper than their max depth, so each is laid out again
+	copy_counter::copies = 0;
+	squarelist<copy_counter> upper = slist.split(copy_counter(NUM_NODES * 2));
+	BOOST_CHECK(slist.size() == NUM_NODES * 2);
+	BOOST_CHECK(upper.size() == NUM_NODES * 2);
+	slist.join(std::move(upper));
+	BOOST_CHECK(copy_counter::copies == 0);
+	BOOST_CHECK(upper.size() == 0);
+	BOOST_CHECK(slist.size() == NUM_NODES * 4);
+	int expected = 0;
+	for(squarelist<copy_counter>::iterator iter = slist.begin(); iter != slist.end(); ++iter)
+		BOOST_CHECK((*iter).value == expected++);
+}
+
+/* Test that the ordering of the squarelist follows the comparison object*/
+BOOST_AUTO_TEST_CASE(custom_comparator){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	squarelist<int, greater<int>> slist;
+	multiset<int, greater<int>> history;
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.insert(value);
+	}
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	BOOST_CHECK(slist.front() == *history.begin());
+	BOOST_CHECK(*slist.find(*history.rbegin()) == slist.back());
+	BOOST_CHECK(slist.find(-1) == slist.end());
+	BOOST_CHECK(slist.count(512) == history.count(512));
+	BOOST_CHECK(slist.rank(512) == (std::size_t)std::distance(history.begin(), history.lower_bound(512)));
+
+	squarelist<int, greater<int>> upper = slist.split(512);
+	BOOST_CHECK(std::equal(history.begin(), history.lower_bound(512), slist.begin()));
+	BOOST_CHECK(std::equal(history.lower_bound(512), history.end(), upper.begin()));
+	slist.join(std::move(upper));
+
+	for(unsigned i = 0; i < NUM_NODES / 2; i++){
+		int value = valueDistribution(randomEngine);
+		BOOST_CHECK(slist.erase(value) == (history.find(value) != history.end()));
+		if(history.find(value) != history.end())
+			history.erase(history.find(value));
+	}
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+}
+
+/* Allocator that counts the blocks it has handed out and not yet taken back*/
+long allocated_blocks = 0;
+template<typename T_>
+struct counting_allocator{
+	typedef T_ value_type;
+	counting_allocator(){}
+	template<typename U_> counting_allocator(counting_allocator<U_> const&){}
+	T_* allocate(std::size_t n){ ++allocated_blocks; return static_cast<T_*>(::operator new(n * sizeof(T_))); }
+	void deallocate(T_* p, std::size_t){ --allocated_blocks; ::operator delete(p); }
+};
+template<typename T_, typename U_>
+bool operator==(counting_allocator<T_> const&, counting_allocator<U_> const&){ return true; }
+template<typename T_, typename U_>
+bool operator!=(counting_allocator<T_> const&, counting_allocator<U_> const&){ return false; }
+
+/* Test that every list of the squarelist is built from its allocator*/
+BOOST_AUTO_TEST_CASE(custom_allocator){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	long before = allocated_blocks;
+	{
+		squarelist<int, less<int>, counting_allocator<int>> slist;
+		multiset<int> history;
+		for(unsigned i = 0; i < NUM_NODES; i++){
+			int value = valueDistribution(randomEngine);
+			slist.insert(value);
+			history.insert(value);
+		}
+		BOOST_CHECK(allocated_blocks - before >= (long)NUM_NODES);
+		BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+
+		squarelist<int, less<int>, counting_allocator<int>> upper = slist.split(512);
+		slist.merge(upper);
+		slist.insert(history.begin(), history.end());
+		BOOST_CHECK(slist.size() == 2 * history.size());
+		slist.erase(slist.begin(), slist.begin() + slist.size() / 2);
+		slist.clear();
+	}
+	BOOST_CHECK(allocated_blocks == before);
+}
+
+/* Allocator whose copies only compare equal when they come from the same arena, each arena counts its live blocks*/
+long arena_blocks[2] = {0, 0};
+template<typename T_>
+struct arena_allocator{
+	typedef T_ value_type;
+	int arena;
+	arena_allocator(int a = 0) : arena(a){}
+	template<typename U_> arena_allocator(arena_allocator<U_> const& rhs) : arena(rhs.arena){}
+	T_* allocate(std::size_t n){ ++arena_blocks[arena]; return static_cast<T_*>(::operator new(n * sizeof(T_))); }
+	void deallocate(T_* p, std::size_t){ --arena_blocks[arena]; ::operator delete(p); }
+};
+template<typename T_, typename U_>
+bool operator==(arena_allocator<T_> const& lhs, arena_allocator<U_> const& rhs){ return lhs.arena == rhs.arena; }
+template<typename T_, typename U_>
+bool operator!=(arena_allocator<T_> const& lhs, arena_allocator<U_> const& rhs){ return lhs.arena != rhs.arena; }
+
+/* Test that merging and joining never hands a node to a list whose allocator did not make it*/
+BOOST_AUTO_TEST_CASE(unequal_allocators){
+	typedef squarelist<int, less<int>, arena_allocator<int>> arena_squarelist;
+	{
+		arena_squarelist slist(less<int>(), arena_allocator<int>(0));
+		multiset<int> history;
+		for(int i = 0; i < NUM_NODES; i++){
+			slist.insert(i * 2);
+			history.insert(i * 2);
+		}
+		{
+			arena_squarelist other(less<int>(), arena_allocator<int>(1));
+			for(int i = 0; i < NUM_NODES; i++){
+				other.insert(i * 2 + 1);
+				history.insert(i * 2 + 1);
+			}
+			slist.merge(std::move(other));
+		}
+		{
+			arena_squarelist other(less<int>(), arena_allocator<int>(1));
+			for(int i = 0; i < NUM_NODES; i++){
+				other.insert(NUM_NODES * 2 + i);
+				history.insert(NUM_NODES * 2 + i);
+			}
+			slist.join(std::move(other));
+		}
+		BOOST_CHECK(arena_blocks[1] == 0);
+		BOOST_CHECK(slist.size() == history.size());
+		BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+		slist.insert(-1);
+		slist.erase(slist.begin(), slist.begin() + slist.size() / 2);
+	}
+	BOOST_CHECK(arena_blocks[0] == 0);
+	BOOST_CHECK(arena_blocks[1] == 0);
+}
+
+/* Test a squarelist laid out in contiguous vertical lists (a tiered vector)*/
+BOOST_AUTO_TEST_CASE(contiguous_columns){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	typedef squarelist<int, less<int>, allocator<int>, column_vector<int>> tiered_vector;
+	tiered_vector slist;
+	multiset<int> history;
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		history.insert(value);
+	}
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	for(unsigned i = 0; i < NUM_NODES / 2; i++){
+		int value = valueDistribution(randomEngine);
+		BOOST_CHECK(slist.erase(value) == (history.find(value) != history.end()));
+		if(history.find(value) != history.end())
+			history.erase(history.find(value));
+	}
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	BOOST_CHECK(slist[slist.size() / 2] == *std::next(history.begin(), history.size() / 2));
+
+	tiered_vector upper = slist.split(512);
+	BOOST_CHECK(std::equal(history.lower_bound(512), history.end(), upper.begin()));
+	slist.merge(std::move(upper));
+	slist.merge(tiered_vector(history.begin(), history.end()));
+	BOOST_CHECK(slist.size() == 2 * history.size());
+	tiered_vector::iterator it = slist.erase(slist.begin() + 1, slist.end() - 1);
+	BOOST_CHECK(slist.size() == 2);
+	BOOST_CHECK(*it == *history.rbegin());
+}
+
+/* Test a squarelist laid out in circular buffer vertical lists*/
+BOOST_AUTO_TEST_CASE(circular_buffer_columns){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	typedef squarelist<int, less<int>, allocator<int>, column_ring<int>> ring_list;
+	ring_list slist;
+	squarelist<int> linked;
+	multiset<int> history;
+	for(unsigned i = 0; i < NUM_NODES; i++){
+		int value = valueDistribution(randomEngine);
+		slist.insert(value);
+		linked.insert(value);
+		history.insert(value);
+	}
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	//the vertical list type changes how values are stored, not how they are balanced
+	BOOST_CHECK(slist.shifts() == linked.shifts());
+	for(unsigned i = 0; i < NUM_NODES / 2; i++){
+		int value = valueDistribution(randomEngine);
+		BOOST_CHECK(slist.erase(value) == (history.find(value) != history.end()));
+		if(history.find(value) != history.end())
+			history.erase(history.find(value));
+	}
+	BOOST_CHECK(slist.size() == history.size());
+	BOOST_CHECK(std::equal(history.begin(), history.end(), slist.begin()));
+	BOOST_CHECK(std::equal(history.rbegin(), history.rend(), slist.rbegin()));
+
+	ring_list upper = slist.split(512);
+	BOOST_CHECK(std::equal(history.lower_bound(512), history.end(), upper.begin()));
+	slist.join(std::move(upper));
+	slist.merge(ring_list(history.begin(), history.end()));
+	BOOST_CHECK(slist.size() == 2 * history.size());
+}
+
+/* Test that balancing relinks nodes, a value keeps its address while other values are added*/
+BOOST_AUTO_TEST_CASE(shifts_keep_nodes){
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0,1024);
+
+	squarelist<int> slist;
+	for(unsigned i = 0; i < NUM_NODES; i++)
+		slist.insert(valueDistribution(randomEngine));
+	vector<int const*> addresses;
+	vector<int> values;
+	for(squarelist<int>::iterator it = slist.begin(); it != slist.end(); ++it){
+		addresses.push_back(&*it);
+		values.push_back(*it);
+	}
+
+	std::size_t shifts = slist.shifts();
+	for(unsigned i = 0; i < NUM_NODES; i++)
+		slist.insert(valueDistribution(randomEngine));
+	BOOST_CHECK(slist.shifts() > shifts);
+
+	set<int const*> after;
+	for(squarelist<int>::iterator it = slist.begin(); it != slist.end(); ++it)
+		after.insert(&*it);
+	for(std::size_t i = 0; i < addresses.size(); ++i){
+		BOOST_CHECK(after.count(addresses[i]) == 1);
+		BOOST_CHECK(*addresses[i] == values[i]);
+	}
+}
+
+/* Test that copies share their storage until one of them writes*/
+BOOST_AUTO_TEST_CASE(copy_on_write){
+	typedef squarelist<int, less<int>, counting_allocator<int>> counted_squarelist;
+	long start = allocated_blocks;
+	{
+		counted_squarelist original;
+		vector<int> values;
+		for(int i = 0; i < NUM_NODES; i++){
+			original.insert(i);
+			values.push_back(i);
+		}
+		long before = allocated_blocks;
+		counted_squarelist snapshot(original);
+		//only the column directory is copied, no value or vertical list
+		BOOST_CHECK(allocated_blocks - before <= 1);
+
+		//the first write clones the outer list and the one vertical list it touches
+		BOOST_CHECK(original.erase(NUM_NODES / 2));
+		BOOST_CHECK(allocated_blocks - before < NUM_NODES / 4);
+		BOOST_CHECK(!original.contains(NUM_NODES / 2));
+		BOOST_CHECK(snapshot.contains(NUM_NODES / 2));
+
+		counted_squarelist assigned;
+		assigned = original;
+		counted_squarelist::iterator position = original.find(10);
+		counted_squarelist early(original);
+		original.erase(position);
+		original.erase(original.begin() + NUM_NODES / 4, original.begin() + NUM_NODES / 3);
+		original.insert(-1);
+		BOOST_CHECK(early.contains(10));
+		BOOST_CHECK(snapshot.size() == NUM_NODES);
+		BOOST_CHECK(std::equal(values.begin(), values.end(), snapshot.begin()));
+		BOOST_CHECK(assigned.size() == NUM_NODES - 1);
+
+		snapshot.erase(snapshot.begin());
+		snapshot.insert(NUM_NODES);
+		BOOST_CHECK(original.front() == -1);
+		BOOST_CHECK(early.front() == 0);
+		BOOST_CHECK(assigned.back() == NUM_NODES - 1);
+
+		counted_squarelist upper = assigned;
+		counted_squarelist lower = upper;
+		upper = lower.split(NUM_NODES / 3);
+		BOOST_CHECK(lower.size() + upper.size() == assigned.size());
+		lower.erase(0);
+		upper.erase(NUM_NODES - 1);
+		lower.join(std::move(upper));
+		counted_squarelist merged = early;
+		merged.erase(10);
+		merged.merge(std::move(lower));
+		BOOST_CHECK(merged.size() == early.size() - 1 + assigned.size() - 2);
+		BOOST_CHECK(assigned.size() == NUM_NODES - 1);
+		BOOST_CHECK(assigned.front() == 0);
+		BOOST_CHECK(early.contains(10));
+
+		original.clear();
+		BOOST_CHECK(original.empty());
+		BOOST_CHECK(early.size() == NUM_NODES - 1);
+		BOOST_CHECK(std::is_sorted(early.begin(), early.end()));
+		BOOST_CHECK(std::is_sorted(merged.begin(), merged.end()));
+	}
+	BOOST_CHECK(allocated_blocks == start);
+}
+
+/* Test that every change made through inserted and erased leaves the earlier versions readable*/
+BOOST_AUTO_TEST_CASE(persistent_versions){
+	typedef squarelist<int, less<int>, counting_allocator<int>> counted_squarelist;
+	const int versionCount = 200;
+	mt19937 randomEngine;
+	randomEngine.seed((unsigned)time( 0 ));
+	uniform_int_distribution<int> valueDistribution(0, 4 * NUM_NODES);
+	long start = allocated_blocks;
+	{
+		vector<counted_squarelist> versions;
+		vector<multiset<int>> history;
+		versions.reserve(versionCount + 1);
+		history.reserve(versionCount + 1);
+		counted_squarelist slist;
+		multiset<int> values;
+		for(int i = 0; i < NUM_NODES; i++){
+			int value = valueDistribution(randomEngine);
+			slist.insert(value);
+			values.insert(value);
+		}
+		versions.push_back(slist);
+		history.push_back(values);
+
+		long before = allocated_blocks;
+		for(int i = 0; i < versionCount; i++){
+			if(i % 4 == 3){
+				int value = versions.back()[valueDistribution(randomEngine) % versions.back().size()];
+				versions.push_back(versions.back().erased(value));
+				values.erase(values.find(value));
+			}else{
+				int value = valueDistribution(randomEngine);
+				versions.push_back(versions.back().inserted(value));
+				values.insert(value);
+			}
+			history.push_back(values);
+		}
+		//untouched vertical lists are shared, only the ones an insert shifts through are cloned
+		BOOST_CHECK(allocated_blocks - before < versionCount * NUM_NODES / 2);
+		for(size_t i = 0; i < versions.size(); i++){
+			BOOST_CHECK(versions[i].size() == history[i].size());
+			BOOST_CHECK(std::equal(history[i].begin(), history[i].end(), versions[i].begin()));
+		}
+		BOOST_CHECK(std::equal(history[0].begin(), history[0].end(), slist.begin()));
+
+		//an old version can be written to, which branches it off without touching the newer ones
+		versions[1].insert(-1);
+		versions[1].erase(versions[1].back());
+		BOOST_CHECK(versions[1].front() == -1);
+		BOOST_CHECK(std::equal(history[2].begin(), history[2].end(), versions[2].begin()));
+		BOOST_CHECK(std::equal(history.back().begin(), history.back().end(), versions.back().begin()));
+		BOOST_CHECK(std::is_sorted(versions[1].begin(), versions[1].end()));
+	}
+	BOOST_CHECK(allocated_blocks == start);
+}
+
+/* Test that readers see a sorted list holding every value no writer touches while a writer works*/
+BOOST_AUTO_TEST_CASE(concurrent_readers){
+	concurrent_squarelist<int> clist;
+	for(int i = 0; i < NUM_NODES; i++)
+		clist.insert(2 * i);
+	BOOST_CHECK(clist.size() == NUM_NODES);
+
+	atomic<bool> done(false);
+	atomic<int> failures(0);
+	vector<thread> readers;
+	for(int reader = 0; reader < 4; reader++){
+		readers.push_back(thread([&clist, &done, &failures, reader](){
+			do{
+				//the even values are never written, the odd ones come and go
+				for(int i = reader; i < NUM_NODES; i += 4)
+					if(!clist.contains(2 * i) || clist.count(2 * i) != 1)
+						++failures;
+				int previous = -1, evens = 0;
+				clist.for_each([&previous, &evens, &failures](int value){
+					if(value < previous)
+						++failures;
+					evens += value % 2 == 0;
+					previous = value;
+				});
+				if(evens != NUM_NODES)
+					++failures;
+				clist.for_each(NUM_NODES / 2, NUM_NODES, [&failures](int value){
+					if(value < NUM_NODES / 2 || value >= NUM_NODES)
+						++failures;
+				});
+				int value = 0;
+				if(!clist.nth(0, value) || value != 0)
+					++failures;
+				//separate calls may see different versions, read sees one
+				if(!clist.read([](concurrent_squarelist<int>::container_type const& slist){ return slist.rank(2 * NUM_NODES) == slist.size(); }))
+					++failures;
+			}while(!done);
+		}));
+	}
+	for(int round = 0; round < 20; round++){
+		for(int i = 0; i < NUM_NODES; i += 3)
+			clist.insert(2 * i + 1);
+		clist.emplace(1);
+		for(int i = 0; i < NUM_NODES; i += 3)
+			BOOST_CHECK(clist.erase(2 * i + 1));
+		BOOST_CHECK(clist.erase(1));
+	}
+	done = true;
+	for(size_t reader = 0; reader < readers.size(); reader++)
+		readers[reader].join();
+	BOOST_CHECK(failures == 0);
+
+	vector<int> odds;
+	for(int i = 0; i < NUM_NODES; i++)
+		odds.push_back(2 * i + 1);
+	clist.insert(odds.begin(), odds.end());
+	BOOST_CHECK(clist.read([](concurrent_squarelist<int>::container_type const& slist){ return std::is_sorted(slist.begin(), slist.end()); }));
+	BOOST_CHECK(clist.erase_range(0, NUM_NODES) == NUM_NODES);
+	BOOST_CHECK(clist.write([](concurrent_squarelist<int>::container_type& slist){ return slist.erase(NUM_NODES); }));
+	clist.clear();
+	BOOST_CHECK(clist.empty());
+}